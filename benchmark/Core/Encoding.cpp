@@ -0,0 +1,66 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <Bull/Core/Encoding.hpp>
+
+/*! \brief Measure the throughput of encoding and decoding a blob
+ *
+ * \param scheme The Scheme to measure
+ * \param name   The name of the scheme in the output
+ * \param size   The number of bytes in the blob
+ *
+ */
+void measure(Bull::Encoding::Scheme scheme, const char* name, std::size_t size)
+{
+    std::vector<unsigned char> data(size);
+    std::vector<char>          text(Bull::Encoding::getEncodedSize(size, scheme));
+    std::mt19937               engine(42);
+    std::size_t                rounds = (std::size_t(1) << 30) / size + 1;
+
+    for(unsigned char& byte : data)
+    {
+        byte = static_cast<unsigned char>(engine());
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for(std::size_t i = 0; i < rounds; i++)
+    {
+        Bull::Encoding::encode(data.data(), size, text.data(), scheme);
+    }
+
+    std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+
+    for(std::size_t i = 0; i < rounds; i++)
+    {
+        if(!Bull::Encoding::decode(Bull::StringView(text.data(), text.size()), data.data(), scheme).isValid())
+        {
+            std::fprintf(stderr, "Unexpected invalid text\n");
+        }
+    }
+
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+    double bytes = static_cast<double>(size) * rounds;
+
+    std::printf("%s,encode,%zu,%.2f\n", name, size, bytes / std::chrono::duration<double, std::nano>(middle - start).count());
+    std::printf("%s,decode,%zu,%.2f\n", name, size, bytes / std::chrono::duration<double, std::nano>(stop - middle).count());
+}
+
+/*! \brief Show the throughput of Base64 and hexadecimal, in bytes of binary data per nanosecond (GB/s)
+ *
+ */
+int main()
+{
+    std::printf("scheme,operation,size,gb_per_s\n");
+
+    for(std::size_t size = 1024; size <= 64 * 1024 * 1024; size *= 16)
+    {
+        measure(Bull::Encoding::Base64, "base64", size);
+        measure(Bull::Encoding::Hex, "hex", size);
+    }
+
+    return 0;
+}
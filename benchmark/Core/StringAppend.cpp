@@ -0,0 +1,50 @@
+#include <chrono>
+#include <cstdio>
+
+#include <Bull/Core/String.hpp>
+
+/*! \brief Append characters one at a time to a String
+ *
+ * \param size The number of characters to append
+ *
+ * \return Return the time spent to append the characters (in nanoseconds)
+ *
+ */
+double appendCharacters(std::size_t size)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Bull::String string;
+
+    for(std::size_t i = 0; i < size; i++)
+    {
+        string += 'a';
+    }
+
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+    if(string.getSize() != size)
+    {
+        std::fprintf(stderr, "Unexpected size: %zu instead of %zu\n", string.getSize(), size);
+    }
+
+    return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+/*! \brief Show that appending to a String one character at a time is linear
+ *
+ * The time per character must stay roughly constant when the final size doubles
+ *
+ */
+int main()
+{
+    std::printf("size,total_ns,ns_per_char\n");
+
+    for(std::size_t size = 1024 * 64; size <= 1024 * 1024; size *= 2)
+    {
+        double total = appendCharacters(size);
+
+        std::printf("%zu,%.0f,%.3f\n", size, total, total / size);
+    }
+
+    return 0;
+}
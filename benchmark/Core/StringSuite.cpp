@@ -0,0 +1,367 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201703L
+    #include <string_view>
+#endif
+
+#include <Bull/Core/IO/StringStream.hpp>
+#include <Bull/Core/String.hpp>
+
+/// Accumulate every result so the compiler can not remove the measured work
+volatile std::size_t sink = 0;
+
+/*! \brief Strings and numbers sharing the same length distribution
+ *
+ */
+struct Distribution
+{
+    const char*               name;
+    std::vector<std::string>  texts;
+    std::vector<Bull::String> strings;
+    std::vector<Bull::Int64>  numbers;
+    std::vector<std::string>  numberTexts;
+    std::vector<Bull::String> numberStrings;
+};
+
+/*! \brief Create a Distribution of comma separated words
+ *
+ * \param name      The name of the distribution in the output
+ * \param minLength The minimum length of a string
+ * \param maxLength The maximum length of a string
+ * \param maxNumber The maximum absolute value of a number
+ * \param count     The number of samples
+ *
+ * \return Return the Distribution created, always the same for the same parameters
+ *
+ */
+Distribution createDistribution(const char* name, std::size_t minLength, std::size_t maxLength, Bull::Int64 maxNumber, std::size_t count)
+{
+    static const char alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+    Distribution                                distribution;
+    std::mt19937_64                             engine(42);
+    std::uniform_int_distribution<std::size_t>  length(minLength, maxLength);
+    std::uniform_int_distribution<std::size_t>  character(0, sizeof(alphabet) - 2);
+    std::uniform_int_distribution<Bull::Int64>  number(-maxNumber, maxNumber);
+
+    distribution.name = name;
+
+    for(std::size_t i = 0; i < count; i++)
+    {
+        std::string text(length(engine), ' ');
+
+        for(std::size_t j = 0; j < text.size(); j++)
+        {
+            /// A word every 8 characters in average
+            text[j] = (engine() % 8 == 0) ? ',' : alphabet[character(engine)];
+        }
+
+        distribution.texts.push_back(text);
+        distribution.strings.push_back(Bull::String(text.data(), text.size()));
+
+        distribution.numbers.push_back(number(engine));
+        distribution.numberTexts.push_back(std::to_string(distribution.numbers.back()));
+        distribution.numberStrings.push_back(Bull::String::number(distribution.numbers.back()));
+    }
+
+    return distribution;
+}
+
+/*! \brief Measure a function called once per sample, and print a line of CSV
+ *
+ * The function is run over every sample as many times as needed to last at least 20 milliseconds,
+ * the fastest of 5 such runs is kept to remove the noise of the system
+ *
+ * \param benchmark      The name of the benchmark
+ * \param implementation The name of the implementation measured
+ * \param distribution   The Distribution of the samples
+ * \param function       The function to measure, taking the index of the sample and returning a value to sink
+ *
+ */
+template <typename Function>
+void measure(const char* benchmark, const char* implementation, const Distribution& distribution, Function function)
+{
+    const std::size_t samples = distribution.texts.size();
+    double            best    = 0.0;
+
+    for(std::size_t run = 0; run < 5; run++)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point stop  = start;
+        std::size_t                           passes = 0;
+
+        do
+        {
+            std::size_t result = 0;
+
+            for(std::size_t i = 0; i < samples; i++)
+            {
+                result += function(i);
+            }
+
+            sink   = sink + result;
+            passes += 1;
+            stop    = std::chrono::steady_clock::now();
+        }
+        while(stop - start < std::chrono::milliseconds(20));
+
+        double perOperation = std::chrono::duration<double, std::nano>(stop - start).count() / (passes * samples);
+
+        if(run == 0 || perOperation < best)
+        {
+            best = perOperation;
+        }
+    }
+
+    std::printf("%s,%s,%s,%zu,%.3f\n", benchmark, implementation, distribution.name, samples, best);
+    std::fflush(stdout);
+}
+
+/*! \brief Split a std::string the same way as String::explode
+ *
+ * \param text      The text to split
+ * \param delimiter The character between two tokens
+ *
+ * \return Return the tokens
+ *
+ */
+std::vector<std::string> explode(const std::string& text, char delimiter)
+{
+    std::vector<std::string> tokens;
+    std::size_t              start = 0;
+
+    /// Empty tokens between two delimiters are kept, only the one after a trailing delimiter is dropped
+    while(start < text.size())
+    {
+        std::size_t position = text.find(delimiter, start);
+
+        if(position == std::string::npos)
+        {
+            tokens.push_back(text.substr(start));
+            break;
+        }
+
+        tokens.push_back(text.substr(start, position - start));
+        start = position + 1;
+    }
+
+    return tokens;
+}
+
+#if __cplusplus >= 201703L
+/*! \brief Split a std::string_view the same way as String::explodeView
+ *
+ * \param text      The text to split
+ * \param delimiter The character between two tokens
+ *
+ * \return Return the tokens
+ *
+ */
+std::vector<std::string_view> explode(std::string_view text, char delimiter)
+{
+    std::vector<std::string_view> tokens;
+    std::size_t                   start = 0;
+
+    /// Empty tokens between two delimiters are kept, only the one after a trailing delimiter is dropped
+    while(start < text.size())
+    {
+        std::size_t position = text.find(delimiter, start);
+
+        if(position == std::string_view::npos)
+        {
+            tokens.push_back(text.substr(start));
+            break;
+        }
+
+        tokens.push_back(text.substr(start, position - start));
+        start = position + 1;
+    }
+
+    return tokens;
+}
+#endif
+
+/*! \brief Measure construction, copy, concatenation and insertion
+ *
+ * \param d The Distribution of the samples
+ *
+ */
+void benchmarkBuilding(const Distribution& d)
+{
+    measure("construct", "Bull::String", d, [&](std::size_t i) { return Bull::String(d.texts[i].data(), d.texts[i].size()).getSize(); });
+    measure("construct", "std::string", d, [&](std::size_t i) { return std::string(d.texts[i].data(), d.texts[i].size()).size(); });
+
+    measure("copy", "Bull::String", d, [&](std::size_t i) { Bull::String copy(d.strings[i]); return copy.getSize(); });
+    measure("copy", "std::string", d, [&](std::size_t i) { std::string copy(d.texts[i]); return copy.size(); });
+
+    measure("concat", "Bull::String", d, [&](std::size_t i) { return (d.strings[i] + d.strings[(i + 1) % d.strings.size()]).getSize(); });
+    measure("concat", "std::string", d, [&](std::size_t i) { return (d.texts[i] + d.texts[(i + 1) % d.texts.size()]).size(); });
+
+    measure("insert", "Bull::String", d, [&](std::size_t i)
+    {
+        Bull::String string = d.strings[i];
+
+        return string.insert(d.strings[(i + 1) % d.strings.size()], string.getSize() / 2).getSize();
+    });
+    measure("insert", "std::string", d, [&](std::size_t i)
+    {
+        std::string string = d.texts[i];
+
+        return string.insert(string.size() / 2, d.texts[(i + 1) % d.texts.size()]).size();
+    });
+}
+
+/*! \brief Measure subString and explode
+ *
+ * \param d The Distribution of the samples
+ *
+ */
+void benchmarkSplitting(const Distribution& d)
+{
+    measure("subString", "Bull::String", d, [&](std::size_t i) { return d.strings[i].subString(d.strings[i].getSize() / 4, d.strings[i].getSize() / 2).getSize(); });
+    measure("subString", "Bull::StringView", d, [&](std::size_t i) { return d.strings[i].subView(d.strings[i].getSize() / 4, d.strings[i].getSize() / 2).getSize(); });
+    measure("subString", "std::string", d, [&](std::size_t i) { return d.texts[i].substr(d.texts[i].size() / 4, d.texts[i].size() / 2 - d.texts[i].size() / 4 + 1).size(); });
+#if __cplusplus >= 201703L
+    measure("subString", "std::string_view", d, [&](std::size_t i) { return std::string_view(d.texts[i]).substr(d.texts[i].size() / 4, d.texts[i].size() / 2 - d.texts[i].size() / 4 + 1).size(); });
+#endif
+
+    measure("explode", "Bull::String", d, [&](std::size_t i) { return d.strings[i].explode(',').size(); });
+    measure("explode", "Bull::StringView", d, [&](std::size_t i) { return d.strings[i].explodeView(',').size(); });
+    measure("explode", "std::string", d, [&](std::size_t i) { return explode(d.texts[i], ',').size(); });
+#if __cplusplus >= 201703L
+    measure("explode", "std::string_view", d, [&](std::size_t i) { return explode(std::string_view(d.texts[i]), ',').size(); });
+#endif
+}
+
+/*! \brief Measure count and case conversions
+ *
+ * \param d The Distribution of the samples
+ *
+ */
+void benchmarkScanning(const Distribution& d)
+{
+    measure("count", "Bull::String", d, [&](std::size_t i) { return static_cast<std::size_t>(d.strings[i].count('a')); });
+    measure("count", "std::string", d, [&](std::size_t i) { return static_cast<std::size_t>(std::count(d.texts[i].begin(), d.texts[i].end(), 'a')); });
+
+    measure("countIgnoreCase", "Bull::String", d, [&](std::size_t i) { return static_cast<std::size_t>(d.strings[i].count('a', 0, false)); });
+    measure("countIgnoreCase", "std::string", d, [&](std::size_t i)
+    {
+        return static_cast<std::size_t>(std::count_if(d.texts[i].begin(), d.texts[i].end(), [](char c) { return c == 'a' || c == 'A'; }));
+    });
+
+    /// Both copy the sample first, so the conversion is done on an owned buffer
+    measure("toUppercase", "Bull::String", d, [&](std::size_t i) { Bull::String string = d.strings[i]; return static_cast<std::size_t>(string.toUppercase()[0]); });
+    measure("toUppercase", "std::string", d, [&](std::size_t i)
+    {
+        std::string string = d.texts[i];
+
+        std::transform(string.begin(), string.end(), string.begin(), [](char c) { return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 32) : c; });
+
+        return static_cast<std::size_t>(string[0]);
+    });
+
+    measure("toLowercase", "Bull::String", d, [&](std::size_t i) { Bull::String string = d.strings[i]; return static_cast<std::size_t>(string.toLowercase()[0]); });
+    measure("toLowercase", "std::string", d, [&](std::size_t i)
+    {
+        std::string string = d.texts[i];
+
+        std::transform(string.begin(), string.end(), string.begin(), [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 32) : c; });
+
+        return static_cast<std::size_t>(string[0]);
+    });
+}
+
+/*! \brief Measure number formatting and parsing
+ *
+ * \param d The Distribution of the samples
+ *
+ */
+void benchmarkNumbers(const Distribution& d)
+{
+    measure("number", "Bull::String", d, [&](std::size_t i) { return Bull::String::number(d.numbers[i]).getSize(); });
+    measure("number", "std::string", d, [&](std::size_t i) { return std::to_string(d.numbers[i]).size(); });
+
+    measure("toInt", "Bull::String", d, [&](std::size_t i) { return static_cast<std::size_t>(d.numberStrings[i].toInt64().value); });
+    measure("toInt", "std::string", d, [&](std::size_t i) { return static_cast<std::size_t>(std::strtoll(d.numberTexts[i].c_str(), nullptr, 10)); });
+}
+
+/*! \brief Measure building a text with a stream
+ *
+ * \param d The Distribution of the samples
+ *
+ */
+void benchmarkStreams(const Distribution& d)
+{
+    measure("stream", "Bull::StringStream", d, [&](std::size_t i)
+    {
+        Bull::StringStream stream;
+
+        stream << d.strings[i] << ' ' << d.numbers[i] << ' ' << d.strings[(i + 1) % d.strings.size()] << ' ' << 0.5;
+
+        return static_cast<std::size_t>(stream.getSize());
+    });
+    measure("stream", "std::ostringstream", d, [&](std::size_t i)
+    {
+        std::ostringstream stream;
+
+        stream << d.texts[i] << ' ' << d.numbers[i] << ' ' << d.texts[(i + 1) % d.texts.size()] << ' ' << 0.5;
+
+        return stream.str().size();
+    });
+}
+
+/*! \brief Measure Bull::String and Bull::StringStream against the standard library
+ *
+ * Every line is "benchmark,implementation,distribution,samples,ns_per_op", lines can be kept between releases to track regressions.
+ * The first argument, if any, only keeps the benchmarks whose name contains it
+ *
+ */
+int main(int argc, char** argv)
+{
+    const char*               filter = argc > 1 ? argv[1] : "";
+    std::vector<Distribution> distributions;
+
+    distributions.push_back(createDistribution("small", 1, 22, 999, 4096));
+    distributions.push_back(createDistribution("medium", 23, 128, 9999999, 4096));
+    distributions.push_back(createDistribution("large", 1024, 4096, 9223372036854775807LL, 512));
+
+    std::printf("benchmark,implementation,distribution,samples,ns_per_op\n");
+
+    for(const Distribution& distribution : distributions)
+    {
+        if(std::strstr("construct copy concat insert", filter))
+        {
+            benchmarkBuilding(distribution);
+        }
+
+        if(std::strstr("subString explode", filter))
+        {
+            benchmarkSplitting(distribution);
+        }
+
+        if(std::strstr("count countIgnoreCase toUppercase toLowercase", filter))
+        {
+            benchmarkScanning(distribution);
+        }
+
+        if(std::strstr("number toInt", filter))
+        {
+            benchmarkNumbers(distribution);
+        }
+
+        if(std::strstr("stream", filter))
+        {
+            benchmarkStreams(distribution);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+#ifndef Bull_Encoding_hpp
+#define Bull_Encoding_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/ParseResult.hpp>
+#include <Bull/Core/String.hpp>
+#include <Bull/Core/StringView.hpp>
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    struct BULL_API Encoding
+    {
+        enum Scheme
+        {
+            Base64, /*!< Base64 from RFC 4648, with padding */
+            Hex     /*!< Hexadecimal, written in lowercase and read in any case */
+        };
+
+        /*! \brief Get the number of characters needed to encode bytes
+         *
+         * \param size   The number of bytes to encode
+         * \param scheme The Scheme to encode with
+         *
+         * \return Return the number of characters
+         *
+         */
+        static std::size_t getEncodedSize(std::size_t size, Scheme scheme);
+
+        /*! \brief Get the number of bytes needed to decode characters
+         *
+         * \param size   The number of characters to decode
+         * \param scheme The Scheme to decode with
+         *
+         * \return Return the number of bytes, padding is not taken into account
+         *
+         */
+        static std::size_t getDecodedCapacity(std::size_t size, Scheme scheme);
+
+        /*! \brief Encode bytes in Base64
+         *
+         * \param data The bytes to encode
+         * \param size The number of bytes
+         *
+         * \return Return the encoded String
+         *
+         */
+        static String toBase64(const void* data, std::size_t size);
+
+        /*! \brief Encode the characters of a string in Base64
+         *
+         * \param string The characters to encode
+         *
+         * \return Return the encoded String
+         *
+         */
+        static String toBase64(const StringView& string);
+
+        /*! \brief Encode bytes in Base64 into a buffer
+         *
+         * \param data   The bytes to encode
+         * \param size   The number of bytes
+         * \param buffer The buffer to fill, it must hold getEncodedSize(size, Base64) characters
+         *
+         * \return Return the number of characters written, no null character is added
+         *
+         */
+        static std::size_t toBase64(const void* data, std::size_t size, char* buffer);
+
+        /*! \brief Decode Base64 characters
+         *
+         * \param text The characters to decode
+         *
+         * \return Return the decoded bytes, or the index of the first character which can not be decoded
+         *
+         */
+        static ParseResult<String> fromBase64(const StringView& text);
+
+        /*! \brief Decode Base64 characters into a buffer
+         *
+         * \param text   The characters to decode
+         * \param buffer The buffer to fill, it must hold getDecodedCapacity(text.getSize(), Base64) bytes
+         *
+         * \return Return the number of bytes written, or the index of the first character which can not be decoded
+         *
+         */
+        static ParseResult<std::size_t> fromBase64(const StringView& text, void* buffer);
+
+        /*! \brief Encode bytes in hexadecimal
+         *
+         * \param data The bytes to encode
+         * \param size The number of bytes
+         *
+         * \return Return the encoded String
+         *
+         */
+        static String toHex(const void* data, std::size_t size);
+
+        /*! \brief Encode the characters of a string in hexadecimal
+         *
+         * \param string The characters to encode
+         *
+         * \return Return the encoded String
+         *
+         */
+        static String toHex(const StringView& string);
+
+        /*! \brief Encode bytes in hexadecimal into a buffer
+         *
+         * \param data   The bytes to encode
+         * \param size   The number of bytes
+         * \param buffer The buffer to fill, it must hold getEncodedSize(size, Hex) characters
+         *
+         * \return Return the number of characters written, no null character is added
+         *
+         */
+        static std::size_t toHex(const void* data, std::size_t size, char* buffer);
+
+        /*! \brief Decode hexadecimal characters
+         *
+         * \param text The characters to decode
+         *
+         * \return Return the decoded bytes, or the index of the first character which can not be decoded
+         *
+         */
+        static ParseResult<String> fromHex(const StringView& text);
+
+        /*! \brief Decode hexadecimal characters into a buffer
+         *
+         * \param text   The characters to decode
+         * \param buffer The buffer to fill, it must hold getDecodedCapacity(text.getSize(), Hex) bytes
+         *
+         * \return Return the number of bytes written, or the index of the first character which can not be decoded
+         *
+         */
+        static ParseResult<std::size_t> fromHex(const StringView& text, void* buffer);
+
+        /*! \brief Encode bytes into a buffer
+         *
+         * \param data   The bytes to encode
+         * \param size   The number of bytes
+         * \param buffer The buffer to fill, it must hold getEncodedSize(size, scheme) characters
+         * \param scheme The Scheme to encode with
+         *
+         * \return Return the number of characters written, no null character is added
+         *
+         */
+        static std::size_t encode(const void* data, std::size_t size, char* buffer, Scheme scheme);
+
+        /*! \brief Decode characters into a buffer
+         *
+         * \param text   The characters to decode
+         * \param buffer The buffer to fill, it must hold getDecodedCapacity(text.getSize(), scheme) bytes
+         * \param scheme The Scheme to decode with
+         *
+         * \return Return the number of bytes written, or the index of the first character which can not be decoded
+         *
+         */
+        static ParseResult<std::size_t> decode(const StringView& text, void* buffer, Scheme scheme);
+
+    private:
+
+        /*! \brief Encode bytes into a String
+         *
+         * \param data   The bytes to encode
+         * \param size   The number of bytes
+         * \param scheme The Scheme to encode with
+         *
+         * \return Return the encoded String
+         *
+         */
+        static String encodeString(const void* data, std::size_t size, Scheme scheme);
+
+        /*! \brief Decode characters into a String
+         *
+         * \param text   The characters to decode
+         * \param scheme The Scheme to decode with
+         *
+         * \return Return the decoded bytes, or the index of the first character which can not be decoded
+         *
+         */
+        static ParseResult<String> decodeString(const StringView& text, Scheme scheme);
+    };
+}
+
+#endif // Bull_Encoding_hpp
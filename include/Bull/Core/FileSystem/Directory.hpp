@@ -4,6 +4,8 @@
 #include <memory>
 #include <vector>
 
+#include <Bull/Core/FileSystem/DirectoryCopyListener.hpp>
+#include <Bull/Core/FileSystem/DirectoryCopyReport.hpp>
 #include <Bull/Core/FileSystem/DirectoryHandler.hpp>
 #include <Bull/Core/FileSystem/FileSystemEntity.hpp>
 #include <Bull/Core/Integer.hpp>
@@ -25,9 +27,13 @@ namespace Bull
             None        = 0x00,
             Files       = 0x01,
             Directories = 0x02,
-            All         = Files | Directories
+            Links       = 0x08, /*!< Symbolic links, they are never reported as files or directories */
+            All         = Files | Directories | Links,
+            Details     = 0x04  /*!< Fill the size and the dates of the entities, it can cost a system call per entity. A link is described itself, not its target */
         };
 
+        static constexpr unsigned int DefaultCopyThreadCount = 8;
+
         /*! \brief Create a directory
          *
          * \param path The path of the directory to create
@@ -56,6 +62,21 @@ namespace Bull
          */
         static bool copy(const String& path, const String& newPath);
 
+        /*! \brief Copy a directory with several threads
+         *
+         * The calling thread walks through the directory while the others copy the files it finds.
+         * Symbolic links are neither followed nor copied, their paths are reported as errors
+         *
+         * \param path        The path (relative or absolute) of the directory to copy
+         * \param newPath     The new path (relative or absolute) of the directory
+         * \param threadCount The number of threads copying files
+         * \param listener    The listener to notify after each file, or nullptr
+         *
+         * \return Return the number of files and bytes copied, with the paths which could not be copied
+         *
+         */
+        static DirectoryCopyReport copy(const String& path, const String& newPath, unsigned int threadCount, DirectoryCopyListener* listener = nullptr);
+
         /*! \brief Rename a directory
          *
          * \param path The path of the directory to rename
@@ -0,0 +1,33 @@
+#ifndef Bull_DirectoryCopyListener_hpp
+#define Bull_DirectoryCopyListener_hpp
+
+#include <Bull/Core/FileSystem/DirectoryCopyReport.hpp>
+#include <Bull/Core/String.hpp>
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    struct BULL_API DirectoryCopyListener
+    {
+        /*! \brief Destructor
+         *
+         */
+        virtual ~DirectoryCopyListener()
+        {
+            /// Nothing
+        }
+
+        /*! \brief Called each time a file was copied or could not be copied
+         *
+         * The copying threads call it one at a time
+         *
+         * \param path    The path of the file or directory
+         * \param success True if the file was copied, false otherwise
+         * \param report  The progress of the whole copy so far
+         *
+         */
+        virtual void onProgress(const String& path, bool success, const DirectoryCopyReport& report) = 0;
+    };
+}
+
+#endif // Bull_DirectoryCopyListener_hpp
@@ -0,0 +1,19 @@
+#ifndef Bull_DirectoryCopyReport_hpp
+#define Bull_DirectoryCopyReport_hpp
+
+#include <vector>
+
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/String.hpp>
+
+namespace Bull
+{
+    struct DirectoryCopyReport
+    {
+        Uint64              copiedSize;  /*!< The number of bytes copied */
+        Uint64              copiedFiles; /*!< The number of files copied */
+        std::vector<String> errors;      /*!< The paths of the files and directories which could not be copied */
+    };
+}
+
+#endif // Bull_DirectoryCopyReport_hpp
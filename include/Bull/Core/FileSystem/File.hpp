@@ -1,6 +1,7 @@
 #ifndef Bull_File_hpp
 #define Bull_File_hpp
 
+#include <cstddef>
 #include <memory>
 
 #include <Bull/Core/FileSystem/FileHandler.hpp>
@@ -10,7 +11,9 @@
 #include <Bull/Core/String.hpp>
 #include <Bull/Core/System/Export.hpp>
 #include <Bull/Core/Thread/Mutex.hpp>
+#include <Bull/Core/Time/Clock.hpp>
 #include <Bull/Core/Time/Date.hpp>
+#include <Bull/Core/Time/Time.hpp>
 
 #ifdef None
     #undef None
@@ -38,6 +41,8 @@ namespace Bull
             ReadWrite = Read | Write,
         };
 
+        static constexpr std::size_t DefaultReadBufferSize = 64 * 1024;
+
         /*! \brief Create a file
          *
          * \param name The name of the file to create
@@ -139,19 +144,37 @@ namespace Bull
 
         /*! \brief Read a line in the file
          *
-         * \param line The line to fill
+         * \param line The line to fill, without its line break
          *
          * \return Return true if the file has still lines to read
          *
          */
         bool readLine(String& line);
 
+        /*! \brief Set the size of the buffer used to read ahead in the file
+         *
+         * Bytes read ahead but not consumed yet are given back to the file
+         *
+         * \param size The size of the buffer, a size of 1 disables reading ahead
+         *
+         */
+        void setReadBufferSize(std::size_t size);
+
+        /*! \brief Get the size of the buffer used to read ahead in the file
+         *
+         * \return Return the size of the buffer
+         *
+         */
+        std::size_t getReadBufferSize() const;
+
         /*! \brief Write a buffer in the file
+         *
+         * When a write buffer is set, small writes are kept in it until the next flush
          *
          * \param data The buffer to write into the file
          * \param size The size of the buffer
          *
-         * \return Return the number of bytes actually written
+         * \return Return the number of bytes actually written or kept in the write buffer
          *
          */
         Uint64 write(const void* data, Uint64 size);
@@ -165,6 +188,67 @@ namespace Bull
          */
         Uint64 write(const String& string);
 
+        /*! \brief Write the bytes kept in the write buffer into the file
+         *
+         * \return Return true if every byte was written, false otherwise
+         *
+         */
+        bool flush();
+
+        /*! \brief Set the size of the buffer used to gather small writes
+         *
+         * The write buffer is flushed when it is full, when flush or close is called,
+         * when the file is read or seeked, and after the flush interval
+         *
+         * \param size The size of the buffer, a size of 0 disables write buffering
+         *
+         */
+        void setWriteBufferSize(std::size_t size);
+
+        /*! \brief Get the size of the buffer used to gather small writes
+         *
+         * \return Return the size of the buffer
+         *
+         */
+        std::size_t getWriteBufferSize() const;
+
+        /*! \brief Set the longest time bytes can stay in the write buffer
+         *
+         * The interval is checked when writing, there is no background flush
+         *
+         * \param interval The interval, Time::Zero to flush only when the buffer is full
+         *
+         */
+        void setFlushInterval(const Time& interval);
+
+        /*! \brief Get the longest time bytes can stay in the write buffer
+         *
+         * \return Return the interval
+         *
+         */
+        Time getFlushInterval() const;
+
+        /*! \brief Get the number of calls to write since the file was opened
+         *
+         * \return Return the number of calls
+         *
+         */
+        Uint64 getWriteCount() const;
+
+        /*! \brief Get the number of writes made to the operating system since the file was opened
+         *
+         * \return Return the number of system calls
+         *
+         */
+        Uint64 getSystemWriteCount() const;
+
+        /*! \brief Get the number of bytes written to the operating system since the file was opened
+         *
+         * \return Return the number of bytes
+         *
+         */
+        Uint64 getWrittenSize() const;
+
         /*! \brief Get the date of the creation of the file
          *
          * \return Return the date of the creation of the file
@@ -262,6 +346,28 @@ namespace Bull
 
     private:
 
+        /*! \brief Fill the free space of the read buffer with the next bytes of the file
+         *
+         * \return Return the number of bytes added to the read buffer
+         *
+         */
+        std::size_t fillReadBuffer();
+
+        /*! \brief Move the cursor of the file back before the bytes read ahead and drop them
+         *
+         */
+        void discardReadBuffer();
+
+        /*! \brief Write bytes into the file, bypassing the write buffer
+         *
+         * \param data The bytes to write
+         * \param size The number of bytes
+         *
+         * \return Return the number of bytes written
+         *
+         */
+        Uint64 writeToFile(const void* data, Uint64 size);
+
         String m_name;
 
         Uint32 m_mode;
@@ -270,6 +376,30 @@ namespace Bull
 
         bool m_eof;
 
+        std::unique_ptr<Uint8[]> m_readBuffer;
+
+        std::size_t m_readBufferSize;
+
+        std::size_t m_readBegin;
+
+        std::size_t m_readEnd;
+
+        std::unique_ptr<Uint8[]> m_writeBuffer;
+
+        std::size_t m_writeBufferSize;
+
+        std::size_t m_writePending;
+
+        Time m_flushInterval;
+
+        Clock m_flushClock;
+
+        Uint64 m_writeCount;
+
+        Uint64 m_systemWriteCount;
+
+        Uint64 m_writtenSize;
+
         mutable Mutex m_mutex;
     };
 }
@@ -12,6 +12,7 @@ namespace Bull
         String name;
         bool   isFile;
         bool   isDirectory;
+        bool   isLink;
         Uint64 size;
         Date   creationDate;
         Date   lastAccessDate;
@@ -0,0 +1,208 @@
+#ifndef Bull_MappedFile_hpp
+#define Bull_MappedFile_hpp
+
+#include <memory>
+
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/IO/InStream.hpp>
+#include <Bull/Core/Pattern/NonCopyable.hpp>
+#include <Bull/Core/String.hpp>
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        class MappedFileImpl;
+    }
+
+    class BULL_API MappedFile : public InStream, public NonCopyable
+    {
+    public:
+
+        enum Access
+        {
+            ReadOnly,  /*!< The mapped bytes can only be read */
+            ReadWrite, /*!< Changes to the mapped bytes are written back into the file */
+        };
+
+        enum Advice
+        {
+            Normal,     /*!< No particular access pattern */
+            Sequential, /*!< The bytes will be read in order, pages can be read ahead aggressively */
+            Random,     /*!< The bytes will be read in random order, reading ahead is useless */
+            WillNeed,   /*!< The bytes will be needed soon, start loading them now */
+            HugePage,   /*!< Back the mapping with huge pages when the system supports it */
+        };
+
+    public:
+
+        /*! \brief Constructor
+         *
+         */
+        MappedFile();
+
+        /*! \brief Constructor
+         *
+         * \param name   The name of the file to map
+         * \param access The Access to the mapped bytes
+         * \param offset The offset in the file of the first byte to map
+         * \param size   The number of bytes to map, 0 to map up to the end of the file
+         *
+         */
+        MappedFile(const String& name, Access access = ReadOnly, Uint64 offset = 0, Uint64 size = 0);
+
+        /*! \brief Destructor
+         *
+         */
+        ~MappedFile();
+
+        /*! \brief Open and map a file
+         *
+         * \param name   The name of the file to map
+         * \param access The Access to the mapped bytes
+         * \param offset The offset in the file of the first byte to map
+         * \param size   The number of bytes to map, 0 to map up to the end of the file
+         *
+         * \return Return true if the file was mapped successfully, false otherwise
+         *
+         */
+        bool open(const String& name, Access access = ReadOnly, Uint64 offset = 0, Uint64 size = 0);
+
+        /*! \brief Check if a file is open
+         *
+         * \return Return true if the file is open, false otherwise
+         *
+         */
+        bool isOpen() const;
+
+        /*! \brief Unmap and close the file
+         *
+         */
+        void close();
+
+        /*! \brief Map another window of the open file
+         *
+         * The previous window is unmapped and the cursor goes back to the start of the new one,
+         * the last Advice given with advise is applied to the new window
+         *
+         * \param offset The offset in the file of the first byte to map
+         * \param size   The number of bytes to map, 0 to map up to the end of the file
+         *
+         * \return Return true if the window was mapped successfully, false otherwise
+         *
+         */
+        bool map(Uint64 offset, Uint64 size = 0);
+
+        /*! \brief Tell the system how the mapped bytes will be accessed
+         *
+         * The advice is kept and given again for every window mapped later
+         *
+         * \param advice The Advice to give
+         *
+         * \return Return true if the system took the advice or if no window is mapped yet, false otherwise
+         *
+         */
+        bool advise(Advice advice);
+
+        /*! \brief Write the changes made to the mapped bytes back into the file
+         *
+         * \return Return true if the changes were written successfully, false otherwise
+         *
+         */
+        bool flush();
+
+        /*! \brief Copy mapped bytes starting at the cursor
+         *
+         * \param data A pointer to the memory area to fill
+         * \param size The size of the memory area to fill
+         *
+         * \return Return the number of read bytes
+         *
+         */
+        Uint64 read(void* data, Uint64 size);
+
+        /*! \brief Set the reading position in the window
+         *
+         * \param position The position to seek to
+         *
+         * \return Return the actual position, the size of the window at most
+         *
+         */
+        Uint64 setCursor(Uint64 position);
+
+        /*! \brief Get the reading position in the window
+         *
+         * \return Return the current position
+         *
+         */
+        Uint64 getCursor() const;
+
+        /*! \brief Get the size of the window
+         *
+         * \return Return the number of mapped bytes
+         *
+         */
+        Uint64 getSize() const;
+
+        /*! \brief Get the offset of the window in the file
+         *
+         * \return Return the offset of the first mapped byte
+         *
+         */
+        Uint64 getOffset() const;
+
+        /*! \brief Get the size of the file
+         *
+         * \return Return the size of the file
+         *
+         */
+        Uint64 getFileSize() const;
+
+        /*! \brief Get the name of the file
+         *
+         * \return Return the name of the file
+         *
+         */
+        String getName() const;
+
+        /*! \brief Get the Access to the mapped bytes
+         *
+         * \return Return the Access
+         *
+         */
+        Access getAccess() const;
+
+        /*! \brief Get the mapped bytes
+         *
+         * \return Return the first byte of the window, nullptr if nothing is mapped
+         *
+         */
+        const Uint8* getData() const;
+
+        /*! \brief Get the mapped bytes to modify them
+         *
+         * \return Return the first byte of the window, nullptr if nothing is mapped or if the file is mapped as ReadOnly
+         *
+         */
+        Uint8* getWritableData();
+
+    private:
+
+        String m_name;
+
+        Access m_access;
+
+        Advice m_advice;
+
+        std::unique_ptr<prv::MappedFileImpl> m_impl;
+
+        Uint64 m_offset;
+
+        Uint64 m_size;
+
+        Uint64 m_cursor;
+    };
+}
+
+#endif // Bull_MappedFile_hpp
@@ -0,0 +1,429 @@
+#ifndef Bull_Format_hpp
+#define Bull_Format_hpp
+
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/String.hpp>
+#include <Bull/Core/StringView.hpp>
+#include <Bull/Core/System/Export.hpp>
+#include <Bull/Core/Time/Date.hpp>
+#include <Bull/Core/Time/Time.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        template <typename T>
+        struct AlwaysFalse : std::false_type
+        {
+            /// Nothing
+        };
+    }
+
+    /*! \brief Write a value of some type into a formatted String
+     *
+     * A Formatter is created from the value to write, tells how many characters it needs
+     * then writes them. Every type used with format needs a specialization
+     *
+     */
+    template <typename T, typename Enable = void>
+    struct Formatter
+    {
+        static_assert(prv::AlwaysFalse<T>::value, "There is no Formatter for this type");
+    };
+
+    template <>
+    struct BULL_API Formatter<StringView>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The characters to write, they must outlive the Formatter
+         *
+         */
+        explicit Formatter(const StringView& value);
+
+        /*! \brief Get the number of characters to write
+         *
+         * \return Return the number of characters
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Write the characters
+         *
+         * \param output The buffer to write in, it must hold getSize() characters
+         *
+         */
+        void write(char* output) const;
+
+    private:
+
+        StringView m_value;
+    };
+
+    template <>
+    struct BULL_API Formatter<String> : Formatter<StringView>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The String to write, it must outlive the Formatter
+         *
+         */
+        explicit Formatter(const String& value);
+    };
+
+    template <>
+    struct BULL_API Formatter<const char*> : Formatter<StringView>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The null terminated string to write, it must outlive the Formatter
+         *
+         */
+        explicit Formatter(const char* value);
+    };
+
+    template <>
+    struct BULL_API Formatter<char*> : Formatter<const char*>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The null terminated string to write, it must outlive the Formatter
+         *
+         */
+        explicit Formatter(const char* value);
+    };
+
+    template <std::size_t N>
+    struct Formatter<char[N]> : Formatter<const char*>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The null terminated string to write, it must outlive the Formatter
+         *
+         */
+        explicit Formatter(const char (&value)[N]);
+    };
+
+    template <>
+    struct BULL_API Formatter<char>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The character to write
+         *
+         */
+        explicit Formatter(char value);
+
+        /*! \brief Get the number of characters to write
+         *
+         * \return Return the number of characters
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Write the character
+         *
+         * \param output The buffer to write in, it must hold getSize() characters
+         *
+         */
+        void write(char* output) const;
+
+    private:
+
+        char m_value;
+    };
+
+    template <>
+    struct BULL_API Formatter<bool> : Formatter<StringView>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The boolean to write, as true or false
+         *
+         */
+        explicit Formatter(bool value);
+    };
+
+    template <typename T>
+    struct Formatter<T, typename std::enable_if<std::is_integral<T>::value || std::is_floating_point<T>::value>::type>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The number to write, formatted as String::number does
+         *
+         */
+        explicit Formatter(T value);
+
+        /*! \brief Get the number of characters to write
+         *
+         * \return Return the number of characters
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Write the number
+         *
+         * \param output The buffer to write in, it must hold getSize() characters
+         *
+         */
+        void write(char* output) const;
+
+    private:
+
+        char        m_buffer[String::NumberCapacity];
+        std::size_t m_size;
+    };
+
+    template <>
+    struct BULL_API Formatter<Time>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The Time to write, in seconds followed by s
+         *
+         */
+        explicit Formatter(const Time& value);
+
+        /*! \brief Get the number of characters to write
+         *
+         * \return Return the number of characters
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Write the Time
+         *
+         * \param output The buffer to write in, it must hold getSize() characters
+         *
+         */
+        void write(char* output) const;
+
+    private:
+
+        char        m_buffer[String::NumberCapacity + 1];
+        std::size_t m_size;
+    };
+
+    template <>
+    struct BULL_API Formatter<Date>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The Date to write, as year/month/day hour:minute:second
+         *
+         */
+        explicit Formatter(const Date& value);
+
+        /*! \brief Get the number of characters to write
+         *
+         * \return Return the number of characters
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Write the Date
+         *
+         * \param output The buffer to write in, it must hold getSize() characters
+         *
+         */
+        void write(char* output) const;
+
+    private:
+
+        char        m_buffer[String::NumberCapacity];
+        std::size_t m_size;
+    };
+
+    namespace prv
+    {
+        struct FormatArgument
+        {
+            const void* formatter;
+            std::size_t size;
+            void (*write)(const void* formatter, char* output);
+        };
+
+        template <std::size_t Placeholders, std::size_t Arguments>
+        struct FormatCheck
+        {
+            static_assert(Placeholders == Arguments, "The number of placeholders does not match the number of arguments");
+        };
+
+        struct BULL_API FormatEngine
+        {
+            /*! \brief Count the placeholders of a pattern at compile time
+             *
+             * \param pattern The null terminated pattern
+             *
+             * \return Return the number of {} in the pattern, {{ and }} being escaped braces
+             *
+             */
+            static constexpr std::size_t countPlaceholders(const char* pattern)
+            {
+                std::size_t count = 0;
+
+                for(std::size_t i = 0; pattern[i]; i++)
+                {
+                    if(pattern[i] == '{' && (pattern[i + 1] == '{' || pattern[i + 1] == '}'))
+                    {
+                        count += (pattern[i + 1] == '}') ? 1 : 0;
+                        i     += 1;
+                    }
+                    else if(pattern[i] == '}' && pattern[i + 1] == '}')
+                    {
+                        i += 1;
+                    }
+                }
+
+                return count;
+            }
+
+            /*! \brief Count some arguments, only used unevaluated by BULL_FORMAT
+             *
+             */
+            template <typename... Arguments>
+            static std::integral_constant<std::size_t, sizeof...(Arguments)> countArguments(const Arguments&... arguments);
+
+            /*! \brief Compute the size of a formatted text
+             *
+             * \param pattern   The pattern to format
+             * \param arguments The arguments to put instead of the placeholders
+             * \param count     The number of arguments
+             *
+             * \return Return the number of characters of the formatted text
+             *
+             */
+            static std::size_t getSize(const StringView& pattern, const FormatArgument* arguments, std::size_t count);
+
+            /*! \brief Write a formatted text
+             *
+             * \param pattern   The pattern to format
+             * \param arguments The arguments to put instead of the placeholders
+             * \param count     The number of arguments
+             * \param output    The buffer to write in, it must hold getSize(pattern, arguments, count) characters
+             *
+             */
+            static void write(const StringView& pattern, const FormatArgument* arguments, std::size_t count, char* output);
+
+            /*! \brief Format a text into a String
+             *
+             * \param pattern   The pattern to format
+             * \param arguments The arguments to put instead of the placeholders
+             * \param count     The number of arguments
+             *
+             * \return Return the formatted String
+             *
+             */
+            static String format(const StringView& pattern, const FormatArgument* arguments, std::size_t count);
+
+            /*! \brief Format a text into a buffer
+             *
+             * \param buffer    The buffer to write in
+             * \param capacity  The number of characters the buffer can hold
+             * \param pattern   The pattern to format
+             * \param arguments The arguments to put instead of the placeholders
+             * \param count     The number of arguments
+             *
+             * \return Return the size of the formatted text, nothing is written if it does not fit with a null character
+             *
+             */
+            static std::size_t formatTo(char* buffer, std::size_t capacity, const StringView& pattern, const FormatArgument* arguments, std::size_t count);
+        };
+
+        template <typename... Arguments>
+        class FormatArgumentList
+        {
+        public:
+
+            /*! \brief Constructor
+             *
+             * \param arguments The values to format, they must outlive the FormatArgumentList
+             *
+             */
+            explicit FormatArgumentList(const Arguments&... arguments);
+
+            FormatArgumentList(const FormatArgumentList& copy) = delete;
+
+            FormatArgumentList& operator=(const FormatArgumentList& copy) = delete;
+
+            /*! \brief Get the arguments
+             *
+             * \return Return the arguments, ready for FormatEngine
+             *
+             */
+            const FormatArgument* getArguments() const;
+
+        private:
+
+            /*! \brief Write a value through its Formatter
+             *
+             * \param formatter The Formatter of the value
+             * \param output    The buffer to write in
+             *
+             */
+            template <typename T>
+            static void writeArgument(const void* formatter, char* output);
+
+            /*! \brief Create the FormatArgument of every Formatter
+             *
+             */
+            template <std::size_t... Indices>
+            void fillArguments(std::index_sequence<Indices...>);
+
+            std::tuple<Formatter<Arguments>...> m_formatters;
+            FormatArgument                      m_arguments[sizeof...(Arguments) + 1];
+        };
+    }
+
+    /*! \brief Format a text, each {} of the pattern being replaced by the next argument
+     *
+     * {{ and }} write a single brace. A placeholder without argument is kept as is,
+     * use BULL_FORMAT to check the placeholders at compile time
+     *
+     * \param pattern   The pattern to format
+     * \param arguments The values to put instead of the placeholders
+     *
+     * \return Return the formatted String, allocated once
+     *
+     */
+    template <typename... Arguments>
+    String format(const StringView& pattern, const Arguments&... arguments);
+
+    /*! \brief Format a text into a buffer, each {} of the pattern being replaced by the next argument
+     *
+     * \param buffer    The buffer to write in
+     * \param capacity  The number of characters the buffer can hold
+     * \param pattern   The pattern to format
+     * \param arguments The values to put instead of the placeholders
+     *
+     * \return Return the size of the formatted text, nothing is written if it does not fit with a null character
+     *
+     */
+    template <typename... Arguments>
+    std::size_t formatTo(char* buffer, std::size_t capacity, const StringView& pattern, const Arguments&... arguments);
+}
+
+/*! \brief Format a text after checking at compile time that the literal pattern has one placeholder per argument
+ *
+ * The first argument is the pattern, it can be used alone: BULL_FORMAT("plain")
+ *
+ */
+#define BULL_FORMAT(...)                                                                                       \
+    (::Bull::prv::FormatCheck<::Bull::prv::FormatEngine::countPlaceholders(BULL_FORMAT_PATTERN(__VA_ARGS__, )), \
+                              decltype(::Bull::prv::FormatEngine::countArguments(__VA_ARGS__))::value - 1>(), \
+     ::Bull::format(__VA_ARGS__))
+
+/*! \brief Get the pattern given to BULL_FORMAT, the trailing empty argument lets it come alone
+ *
+ */
+#define BULL_FORMAT_PATTERN(pattern, ...) pattern
+
+#include <Bull/Core/Format.inl>
+
+#endif // Bull_Format_hpp
@@ -0,0 +1,140 @@
+namespace Bull
+{
+    /*! \brief Constructor
+     *
+     * \param value The null terminated string to write, it must outlive the Formatter
+     *
+     */
+    template <std::size_t N>
+    Formatter<char[N]>::Formatter(const char (&value)[N]) :
+        Formatter<const char*>(value)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value The number to write, formatted as String::number does
+     *
+     */
+    template <typename T>
+    Formatter<T, typename std::enable_if<std::is_integral<T>::value || std::is_floating_point<T>::value>::type>::Formatter(T value)
+    {
+        typedef typename std::conditional<std::is_floating_point<T>::value, T,
+                typename std::conditional<std::is_signed<T>::value, Int64, Uint64>::type>::type Number;
+
+        m_size = String::number(static_cast<Number>(value), m_buffer);
+    }
+
+    /*! \brief Get the number of characters to write
+     *
+     * \return Return the number of characters
+     *
+     */
+    template <typename T>
+    std::size_t Formatter<T, typename std::enable_if<std::is_integral<T>::value || std::is_floating_point<T>::value>::type>::getSize() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Write the number
+     *
+     * \param output The buffer to write in, it must hold getSize() characters
+     *
+     */
+    template <typename T>
+    void Formatter<T, typename std::enable_if<std::is_integral<T>::value || std::is_floating_point<T>::value>::type>::write(char* output) const
+    {
+        std::memcpy(output, m_buffer, m_size);
+    }
+
+    namespace prv
+    {
+        /*! \brief Constructor
+         *
+         * \param arguments The values to format, they must outlive the FormatArgumentList
+         *
+         */
+        template <typename... Arguments>
+        FormatArgumentList<Arguments...>::FormatArgumentList(const Arguments&... arguments) :
+            m_formatters(arguments...)
+        {
+            fillArguments(std::index_sequence_for<Arguments...>());
+        }
+
+        /*! \brief Get the arguments
+         *
+         * \return Return the arguments, ready for FormatEngine
+         *
+         */
+        template <typename... Arguments>
+        const FormatArgument* FormatArgumentList<Arguments...>::getArguments() const
+        {
+            return m_arguments;
+        }
+
+        /*! \brief Write a value through its Formatter
+         *
+         * \param formatter The Formatter of the value
+         * \param output    The buffer to write in
+         *
+         */
+        template <typename... Arguments>
+        template <typename T>
+        void FormatArgumentList<Arguments...>::writeArgument(const void* formatter, char* output)
+        {
+            static_cast<const T*>(formatter)->write(output);
+        }
+
+        /*! \brief Create the FormatArgument of every Formatter
+         *
+         */
+        template <typename... Arguments>
+        template <std::size_t... Indices>
+        void FormatArgumentList<Arguments...>::fillArguments(std::index_sequence<Indices...>)
+        {
+            /// The formatters are sized here, in the first pass, so the text is written once without guessing
+            using Expand = int[];
+            (void)Expand{0, (m_arguments[Indices] = FormatArgument{&std::get<Indices>(m_formatters),
+                                                                   std::get<Indices>(m_formatters).getSize(),
+                                                                   &writeArgument<typename std::tuple_element<Indices, std::tuple<Formatter<Arguments>...>>::type>}, 0)...};
+        }
+    }
+
+    /*! \brief Format a text, each {} of the pattern being replaced by the next argument
+     *
+     * {{ and }} write a single brace. A placeholder without argument is kept as is,
+     * use BULL_FORMAT to check the placeholders at compile time
+     *
+     * \param pattern   The pattern to format
+     * \param arguments The values to put instead of the placeholders
+     *
+     * \return Return the formatted String, allocated once
+     *
+     */
+    template <typename... Arguments>
+    String format(const StringView& pattern, const Arguments&... arguments)
+    {
+        prv::FormatArgumentList<Arguments...> list(arguments...);
+
+        return prv::FormatEngine::format(pattern, list.getArguments(), sizeof...(Arguments));
+    }
+
+    /*! \brief Format a text into a buffer, each {} of the pattern being replaced by the next argument
+     *
+     * \param buffer    The buffer to write in
+     * \param capacity  The number of characters the buffer can hold
+     * \param pattern   The pattern to format
+     * \param arguments The values to put instead of the placeholders
+     *
+     * \return Return the size of the formatted text, nothing is written if it does not fit with a null character
+     *
+     */
+    template <typename... Arguments>
+    std::size_t formatTo(char* buffer, std::size_t capacity, const StringView& pattern, const Arguments&... arguments)
+    {
+        prv::FormatArgumentList<Arguments...> list(arguments...);
+
+        return prv::FormatEngine::formatTo(buffer, capacity, pattern, list.getArguments(), sizeof...(Arguments));
+    }
+}
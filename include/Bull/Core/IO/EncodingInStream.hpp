@@ -0,0 +1,92 @@
+#ifndef Bull_EncodingInStream_hpp
+#define Bull_EncodingInStream_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/Encoding.hpp>
+#include <Bull/Core/IO/InStream.hpp>
+#include <Bull/Core/Pattern/NonCopyable.hpp>
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    class BULL_API EncodingInStream : public InStream, public NonCopyable
+    {
+    public:
+
+        static constexpr std::size_t TextCapacity = 4096;
+
+    public:
+
+        /*! \brief Constructor
+         *
+         * \param stream The stream to read the encoded characters from, it must outlive the EncodingInStream
+         * \param scheme The Scheme to decode with
+         *
+         */
+        EncodingInStream(InStream& stream, Encoding::Scheme scheme);
+
+        /*! \brief Read and decode characters from the wrapped stream
+         *
+         * Spaces, tabulations and line breaks between the characters are ignored
+         *
+         * \param data A pointer to the memory area to fill
+         * \param size The size of the memory area to fill
+         *
+         * \return Return the number of read bytes, less than size at the end of the wrapped stream or after an invalid character
+         *
+         */
+        Uint64 read(void* data, Uint64 size);
+
+        /*! \brief Check whether every character read so far could be decoded
+         *
+         * \return Return true if no invalid character was found, false otherwise
+         *
+         */
+        bool isValid() const;
+
+        /*! \brief Set the reading position in the stream, an EncodingInStream can not seek
+         *
+         * \param position The position to seek to
+         *
+         * \return Return the actual position
+         *
+         */
+        Uint64 setCursor(Uint64 position);
+
+        /*! \brief Get the reading position in the stream
+         *
+         * \return Return the number of bytes read
+         *
+         */
+        Uint64 getCursor() const;
+
+        /*! \brief Get the size of the stream
+         *
+         * \return Return the largest number of bytes the wrapped stream can give
+         *
+         */
+        Uint64 getSize() const;
+
+    private:
+
+        /*! \brief Read characters from the wrapped stream and decode them
+         *
+         * \return Return true if some bytes were decoded, false otherwise
+         *
+         */
+        bool refill();
+
+        InStream&        m_stream;
+        Encoding::Scheme m_scheme;
+        char             m_text[TextCapacity];
+        std::size_t      m_textSize;
+        Uint8            m_bytes[TextCapacity / 4 * 3];
+        std::size_t      m_bytesBegin;
+        std::size_t      m_bytesEnd;
+        Uint64           m_cursor;
+        bool             m_isValid;
+    };
+}
+
+#endif // Bull_EncodingInStream_hpp
@@ -0,0 +1,80 @@
+#ifndef Bull_EncodingOutStream_hpp
+#define Bull_EncodingOutStream_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/Encoding.hpp>
+#include <Bull/Core/IO/OutStream.hpp>
+#include <Bull/Core/Pattern/NonCopyable.hpp>
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    class BULL_API EncodingOutStream : public OutStream, public NonCopyable
+    {
+    public:
+
+        /*! \brief Constructor
+         *
+         * \param stream The stream to write the encoded characters to, it must outlive the EncodingOutStream
+         * \param scheme The Scheme to encode with
+         *
+         */
+        EncodingOutStream(OutStream& stream, Encoding::Scheme scheme);
+
+        /*! \brief Destructor
+         *
+         */
+        ~EncodingOutStream();
+
+        /*! \brief Encode bytes and write them into the wrapped stream
+         *
+         * \param data A pointer to the memory area to encode
+         * \param size The size of the memory area to encode
+         *
+         * \return Return the number of bytes taken, bytes which do not complete a group are kept until the next write
+         *
+         */
+        Uint64 write(const void* data, Uint64 size);
+
+        /*! \brief Encode the bytes kept by the stream, with padding
+         *
+         * The next bytes written start a new encoded text
+         *
+         */
+        void finish();
+
+        /*! \brief Set the writing position in the stream, an EncodingOutStream can not seek
+         *
+         * \param position The position to seek to
+         *
+         * \return Return the actual position
+         *
+         */
+        Uint64 setCursor(Uint64 position);
+
+        /*! \brief Get the writing position in the stream
+         *
+         * \return Return the number of bytes taken
+         *
+         */
+        Uint64 getCursor() const;
+
+        /*! \brief Get the size of the stream
+         *
+         * \return Return the number of bytes taken
+         *
+         */
+        Uint64 getSize() const;
+
+    private:
+
+        OutStream&       m_stream;
+        Encoding::Scheme m_scheme;
+        Uint8            m_pending[3];
+        std::size_t      m_pendingSize;
+        Uint64           m_size;
+    };
+}
+
+#endif // Bull_EncodingOutStream_hpp
@@ -1,15 +1,16 @@
 #ifndef Bull_StringStream_hpp
 #define Bull_StringStream_hpp
 
-#include <vector>
+#include <cstddef>
 
 #include <Bull/Core/System/Export.hpp>
-#include <Bull/Core/IO/InOutStream.hpp>
+#include <Bull/Core/IO/OutStream.hpp>
 #include <Bull/Core/String.hpp>
+#include <Bull/Core/StringView.hpp>
 
 namespace Bull
 {
-    class BULL_API StringStream
+    class BULL_API StringStream : public OutStream
     {
     public:
 
@@ -18,25 +19,65 @@ namespace Bull
          */
         StringStream();
 
-        /*! \brief Empty the stream content
+        /*! \brief Constructor
+         *
+         * \param capacity The number of characters to reserve
+         *
+         */
+        explicit StringStream(std::size_t capacity);
+
+        /*! \brief Empty the stream content, its memory is kept to be reused
          *
          */
         void clear();
 
+        /*! \brief Write data into the stream at the cursor
+         *
+         * \param data A pointer to the memory area to write
+         * \param size The size of the memory area to write
+         *
+         * \return Return the number of written bytes
+         *
+         */
+        Uint64 write(const void* data, Uint64 size);
+
+        /*! \brief Set the writing position in the stream
+         *
+         * \param position The position to seek to
+         *
+         * \return Return the actual position, which cannot be past the end of the content
+         *
+         */
+        Uint64 setCursor(Uint64 position);
+
+        /*! \brief Get the writing position in the stream
+         *
+         * \return Return the current position
+         *
+         */
+        Uint64 getCursor() const;
+
         /*! \brief Get the size of the content of the stream
          *
          * \return Return the size of the content of the stream
          *
          */
-        std::size_t getSize() const;
+        Uint64 getSize() const;
 
         /*! \brief Get the content of the stream
          *
-         * \return Return the content of the stream
+         * \return Return the content of the stream, sharing the buffer until the stream is written again
          *
          */
         String toString() const;
 
+        /*! \brief Take the content of the stream without copying it
+         *
+         * \return Return the content of the stream, which is empty afterward
+         *
+         */
+        String release();
+
         /*! \brief Adds the representation of an integer
          *
          * \param right The integer to add
@@ -46,6 +87,69 @@ namespace Bull
          */
         StringStream& operator<<(int right);
 
+        /*! \brief Adds the representation of an integer
+         *
+         * \param right The integer to add
+         *
+         * \return Return a reference to this
+         *
+         */
+        StringStream& operator<<(unsigned int right);
+
+        /*! \brief Adds the representation of an integer
+         *
+         * \param right The integer to add
+         *
+         * \return Return a reference to this
+         *
+         */
+        StringStream& operator<<(long right);
+
+        /*! \brief Adds the representation of an integer
+         *
+         * \param right The integer to add
+         *
+         * \return Return a reference to this
+         *
+         */
+        StringStream& operator<<(unsigned long right);
+
+        /*! \brief Adds the representation of an integer
+         *
+         * \param right The integer to add
+         *
+         * \return Return a reference to this
+         *
+         */
+        StringStream& operator<<(long long right);
+
+        /*! \brief Adds the representation of an integer
+         *
+         * \param right The integer to add
+         *
+         * \return Return a reference to this
+         *
+         */
+        StringStream& operator<<(unsigned long long right);
+
+        /*! \brief Adds the representation of a floating point number
+         *
+         * \param right The number to add
+         *
+         * \return Return a reference to this
+         *
+         */
+        StringStream& operator<<(float right);
+
+        /*! \brief Adds the representation of a floating point number
+         *
+         * \param right The number to add
+         *
+         * \return Return a reference to this
+         *
+         */
+        StringStream& operator<<(double right);
+
         /*! \brief Adds the representation of a boolean
          *
          * \param right The boolean to add
@@ -82,6 +186,15 @@ namespace Bull
          */
         StringStream& operator<<(const String& right);
 
+        /*! \brief Adds the viewed characters
+         *
+         * \param right The StringView to add
+         *
+         * \return Return a reference to this
+         *
+         */
+        StringStream& operator<<(const StringView& right);
+
         /*! \brief Convert the StringStream to a String
          *
          * \return Return the representation of this as a String
@@ -91,8 +204,34 @@ namespace Bull
 
     private:
 
-        std::vector<String> m_content;
-        std::size_t m_bufferSize;
+        /*! \brief Make room for characters at the cursor
+         *
+         * \param size The number of characters to write
+         *
+         * \return Return where to write the characters
+         *
+         */
+        char* prepareWrite(std::size_t size);
+
+        /*! \brief Move the cursor after written characters
+         *
+         * \param size The number of characters written at the cursor
+         *
+         */
+        void commitWrite(std::size_t size);
+
+        /*! \brief Write a number at the cursor
+         *
+         * \param number The number to write
+         *
+         * \return Return a reference to this
+         *
+         */
+        template <typename T>
+        StringStream& writeNumber(T number);
+
+        String      m_buffer;
+        std::size_t m_cursor;
     };
 }
 
@@ -0,0 +1,137 @@
+#ifndef Bull_InternedString_hpp
+#define Bull_InternedString_hpp
+
+#include <cstddef>
+#include <functional>
+
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/String.hpp>
+#include <Bull/Core/StringView.hpp>
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct InternEntry;
+    }
+
+    class BULL_API InternedString
+    {
+    public:
+
+        struct Statistics
+        {
+            /*! \brief Get the rate of lookups which found an already interned string
+             *
+             * \return Return the hit rate, between 0 and 1
+             *
+             */
+            float getHitRate() const;
+
+            std::size_t count;   /*!< The number of distinct strings interned */
+            std::size_t memory;  /*!< The number of bytes used by the table and the strings */
+            Uint64      lookups; /*!< The number of strings interned since the start */
+            Uint64      hits;    /*!< The number of lookups which found an already interned string */
+        };
+
+        /*! \brief Get the statistics of the interning table
+         *
+         * \return Return the statistics
+         *
+         */
+        static Statistics getStatistics();
+
+    public:
+
+        /*! \brief Default constructor
+         *
+         * The default InternedString is the empty string
+         *
+         */
+        InternedString();
+
+        /*! \brief Constructor
+         *
+         * \param string The string to intern
+         *
+         */
+        InternedString(const StringView& string);
+
+        /*! \brief Constructor
+         *
+         * \param string The string to intern
+         *
+         */
+        InternedString(const char* string);
+
+        /*! \brief Constructor
+         *
+         * \param string The string to intern
+         *
+         */
+        InternedString(const String& string);
+
+        /*! \brief Get the interned string
+         *
+         * \return Return the interned string, which lives until the end of the program
+         *
+         */
+        const String& toString() const;
+
+        /*! \brief Get the hash of the interned string
+         *
+         * \return Return the hash computed when the string was interned
+         *
+         */
+        std::size_t getHash() const;
+
+        /*! \brief Compare two InternedStrings
+         *
+         * \param left  The first InternedString to compare
+         * \param right The second InternedString to compare
+         *
+         * \return Return true if left and right are the same string, false otherwise
+         *
+         */
+        friend bool operator==(const InternedString& left, const InternedString& right);
+
+        /*! \brief Compare two InternedStrings
+         *
+         * \param left  The first InternedString to compare
+         * \param right The second InternedString to compare
+         *
+         * \return Return true if left and right are different strings, false otherwise
+         *
+         */
+        friend bool operator!=(const InternedString& left, const InternedString& right);
+
+        /*! \brief Order two InternedStrings by identity, the order is not lexicographic and changes between runs
+         *
+         * \param left  The first InternedString to compare
+         * \param right The second InternedString to compare
+         *
+         * \return Return true if left is ordered before right, false otherwise
+         *
+         */
+        friend bool operator<(const InternedString& left, const InternedString& right);
+
+    private:
+
+        const prv::InternEntry* m_entry;
+    };
+}
+
+namespace std
+{
+    template<>
+    struct hash<Bull::InternedString>
+    {
+        std::size_t operator()(const Bull::InternedString& string) const
+        {
+            return string.getHash();
+        }
+    };
+}
+
+#endif // Bull_InternedString_hpp
@@ -0,0 +1,115 @@
+#ifndef Bull_KeywordSearcher_hpp
+#define Bull_KeywordSearcher_hpp
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/String.hpp>
+#include <Bull/Core/StringView.hpp>
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    class BULL_API KeywordSearcher
+    {
+    public:
+
+        struct Match
+        {
+            std::size_t keyword;  /*!< The index of the keyword found */
+            std::size_t position; /*!< The index where the keyword begins in the text */
+        };
+
+    public:
+
+        /*! \brief Constructor
+         *
+         * \param keywords The keywords to search, empty keywords are ignored
+         *
+         */
+        KeywordSearcher(std::initializer_list<StringView> keywords);
+
+        /*! \brief Constructor
+         *
+         * \param keywords The keywords to search, empty keywords are ignored
+         *
+         */
+        KeywordSearcher(const std::vector<String>& keywords);
+
+        /*! \brief Find every occurrence of every keyword in a single pass over a text
+         *
+         * \param text The text to search in
+         *
+         * \return Return the occurrences, ordered by the position where they end
+         *
+         */
+        std::vector<Match> findAll(const StringView& text) const;
+
+        /*! \brief Find the occurrence of a keyword which ends first in a text
+         *
+         * \param text  The text to search in
+         * \param match The Match to fill with the occurrence
+         *
+         * \return Return true if a keyword was found, false otherwise
+         *
+         */
+        bool findFirst(const StringView& text, Match& match) const;
+
+        /*! \brief Check whether a text contains any of the keywords
+         *
+         * \param text The text to search in
+         *
+         * \return Return true if a keyword was found, false otherwise
+         *
+         */
+        bool containsAny(const StringView& text) const;
+
+        /*! \brief Get the number of keywords
+         *
+         * \return Return the number of keywords
+         *
+         */
+        std::size_t getKeywordCount() const;
+
+        /*! \brief Get a keyword
+         *
+         * \param index The index of the keyword
+         *
+         * \return Return the keyword
+         *
+         */
+        const String& getKeyword(std::size_t index) const;
+
+    private:
+
+        static constexpr Uint32 NoKeyword = 0xFFFFFFFF;
+
+        /*! \brief Add a keyword to the trie
+         *
+         * \param keyword The keyword to add
+         *
+         */
+        void addKeyword(const StringView& keyword);
+
+        /*! \brief Compute the failure transitions to turn the trie into an automaton
+         *
+         */
+        void build();
+
+        /*! \brief Add a state without transition
+         *
+         * \return Return the index of the state
+         *
+         */
+        Uint32 createState();
+
+        std::vector<String> m_keywords;
+        std::vector<Uint32> m_transitions; /*!< 256 transitions per state, the root is the state 0 */
+        std::vector<Uint32> m_keywordEnds; /*!< The keyword ending at each state, NoKeyword if there is none */
+        std::vector<Uint32> m_outputLinks; /*!< The next state on the failure chain where a keyword ends, 0 if there is none */
+    };
+}
+
+#endif // Bull_KeywordSearcher_hpp
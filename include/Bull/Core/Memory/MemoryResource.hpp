@@ -0,0 +1,48 @@
+#ifndef Bull_MemoryResource_hpp
+#define Bull_MemoryResource_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    struct BULL_API MemoryResource
+    {
+        /*! \brief Get the MemoryResource using the global heap
+         *
+         * \return Return the default MemoryResource
+         *
+         */
+        static MemoryResource& getDefault();
+
+        /*! \brief Destructor
+         *
+         */
+        virtual ~MemoryResource()
+        {
+            /// Nothing
+        }
+
+        /*! \brief Allocate a memory area
+         *
+         * \param size      The size of the memory area
+         * \param alignment The alignment of the memory area, a power of two
+         *
+         * \return Return a pointer to the memory area
+         *
+         */
+        virtual void* allocate(std::size_t size, std::size_t alignment) = 0;
+
+        /*! \brief Free a memory area allocated by this MemoryResource
+         *
+         * \param pointer   The pointer to the memory area
+         * \param size      The size given when the memory area was allocated
+         * \param alignment The alignment given when the memory area was allocated
+         *
+         */
+        virtual void deallocate(void* pointer, std::size_t size, std::size_t alignment) = 0;
+    };
+}
+
+#endif // Bull_MemoryResource_hpp
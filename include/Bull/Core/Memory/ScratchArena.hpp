@@ -0,0 +1,128 @@
+#ifndef Bull_ScratchArena_hpp
+#define Bull_ScratchArena_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/Exception.hpp>
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/Memory/MemoryResource.hpp>
+#include <Bull/Core/Pattern/NonCopyable.hpp>
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    /*! \brief Bump pointer allocator whose memory is released all at once, typically every frame
+     *
+     * Allocating only moves a cursor and deallocating does nothing, so a ScratchArena must only be
+     * used by one thread. reset throws if an allocation is still alive, in every build,
+     * which catches Strings escaping the frame they were created in
+     *
+     */
+    class BULL_API ScratchArena : public MemoryResource, public NonCopyable
+    {
+    public:
+
+        DeclarePublicException(EscapedAllocation, "An allocation of a ScratchArena outlived its frame", Log::Level::Error);
+
+        static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+    public:
+
+        /*! \brief Constructor
+         *
+         * \param blockSize The size of the first block of memory
+         *
+         */
+        explicit ScratchArena(std::size_t blockSize = DefaultBlockSize);
+
+        /*! \brief Destructor
+         *
+         */
+        ~ScratchArena();
+
+        /*! \brief Allocate a memory area in the current block, or in a new one when it is full
+         *
+         * \param size      The size of the memory area
+         * \param alignment The alignment of the memory area, a power of two
+         *
+         * \return Return a pointer to the memory area
+         *
+         */
+        void* allocate(std::size_t size, std::size_t alignment);
+
+        /*! \brief Forget an allocation, its memory is only reused after reset
+         *
+         * \param pointer   The pointer to the memory area
+         * \param size      The size given when the memory area was allocated
+         * \param alignment The alignment given when the memory area was allocated
+         *
+         */
+        void deallocate(void* pointer, std::size_t size, std::size_t alignment);
+
+        /*! \brief Release every allocation and start a new frame
+         *
+         * When several blocks were needed, they are merged into one so the next frame fits in a single block.
+         * Throws EscapedAllocation if an allocation is still alive, the check is made in every build
+         *
+         */
+        void reset();
+
+        /*! \brief Get the number of frames started by reset
+         *
+         * \return Return the current frame
+         *
+         */
+        Uint64 getFrame() const;
+
+        /*! \brief Get the number of allocations not deallocated yet
+         *
+         * \return Return the number of allocations alive
+         *
+         */
+        std::size_t getLiveAllocationCount() const;
+
+        /*! \brief Get the number of bytes allocated since the last reset
+         *
+         * \return Return the number of bytes used, alignment padding included
+         *
+         */
+        std::size_t getUsedSize() const;
+
+        /*! \brief Get the number of bytes held by the arena
+         *
+         * \return Return the total size of the blocks
+         *
+         */
+        std::size_t getCapacity() const;
+
+    private:
+
+        struct Block
+        {
+            Block*      previous;
+            std::size_t size;
+        };
+
+        /*! \brief Allocate a new block and make it the current one
+         *
+         * \param size The number of bytes the block must hold
+         *
+         */
+        void pushBlock(std::size_t size);
+
+        /*! \brief Free every block
+         *
+         */
+        void releaseBlocks();
+
+        Block*      m_block;
+        char*       m_cursor;
+        char*       m_end;
+        std::size_t m_used;
+        std::size_t m_capacity;
+        std::size_t m_liveAllocations;
+        Uint64      m_frame;
+    };
+}
+
+#endif // Bull_ScratchArena_hpp
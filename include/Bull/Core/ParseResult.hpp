@@ -0,0 +1,47 @@
+#ifndef Bull_ParseResult_hpp
+#define Bull_ParseResult_hpp
+
+#include <cstddef>
+
+namespace Bull
+{
+    template <typename T>
+    struct ParseResult
+    {
+        enum Error
+        {
+            NoError,          /*!< The value was parsed successfully */
+            InvalidCharacter, /*!< The text does not begin with a number */
+            OutOfRange        /*!< The number does not fit in the type */
+        };
+
+        /*! \brief Default constructor
+         *
+         */
+        ParseResult();
+
+        /*! \brief Constructor
+         *
+         * \param value    The value parsed
+         * \param consumed The number of characters used by the value
+         * \param error    The error which occurred while parsing
+         *
+         */
+        ParseResult(T value, std::size_t consumed, Error error = NoError);
+
+        /*! \brief Check whether the parsing succeeded
+         *
+         * \return Return true if the value was parsed successfully, false otherwise
+         *
+         */
+        bool isValid() const;
+
+        T           value;    /*!< The value parsed, only meaningful when the parsing succeeded */
+        std::size_t consumed; /*!< The number of characters used by the value */
+        Error       error;    /*!< The error which occurred while parsing */
+    };
+}
+
+#include <Bull/Core/ParseResult.inl>
+
+#endif // Bull_ParseResult_hpp
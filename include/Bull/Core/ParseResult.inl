@@ -0,0 +1,41 @@
+namespace Bull
+{
+    /*! \brief Default constructor
+     *
+     */
+    template <typename T>
+    ParseResult<T>::ParseResult() :
+        value(),
+        consumed(0),
+        error(InvalidCharacter)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value    The value parsed
+     * \param consumed The number of characters used by the value
+     * \param error    The error which occurred while parsing
+     *
+     */
+    template <typename T>
+    ParseResult<T>::ParseResult(T value, std::size_t consumed, Error error) :
+        value(value),
+        consumed(consumed),
+        error(error)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Check whether the parsing succeeded
+     *
+     * \return Return true if the value was parsed successfully, false otherwise
+     *
+     */
+    template <typename T>
+    bool ParseResult<T>::isValid() const
+    {
+        return error == NoError;
+    }
+}
@@ -1,13 +1,25 @@
 #ifndef Bull_String_hpp
 #define Bull_String_hpp
 
-#include <memory>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
 #include <vector>
 
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/Memory/MemoryResource.hpp>
+#include <Bull/Core/ParseResult.hpp>
+#include <Bull/Core/StringView.hpp>
 #include <Bull/Core/System/Export.hpp>
 
 namespace Bull
 {
+    namespace prv
+    {
+        struct FormatEngine;
+    }
+
     class BULL_API String
     {
     public:
@@ -16,6 +28,10 @@ namespace Bull
 
         static constexpr std::size_t npos = -1;
 
+        static constexpr std::size_t SmallCapacity = 23; /*!< The maximum size of a string stored without heap allocation */
+
+        static constexpr std::size_t NumberCapacity = 32; /*!< The size of a buffer large enough to write any number with its null character */
+
         /*! \brief Convert a lowercase character to the uppercase equivalent character
          *
          * \param character the character to convert
@@ -61,6 +77,25 @@ namespace Bull
          */
         static String boolean(bool boolean);
 
+        /*! \brief Concatenate strings with a single allocation
+         *
+         * \param parts The strings to concatenate
+         *
+         * \return Return the concatenated String
+         *
+         */
+        static String concat(std::initializer_list<StringView> parts);
+
+        /*! \brief Concatenate strings with a single allocation
+         *
+         * \param parts The strings to concatenate, anything a StringView can be created from
+         *
+         * \return Return the concatenated String
+         *
+         */
+        template <typename... Parts>
+        static String concat(const Parts&... parts);
+
         /*! \brief Create a String from a number
          *
          * \param number The number to represent in the String
@@ -68,18 +103,259 @@ namespace Bull
          * \return Return a String representing the number
          *
          */
-        static String number(int number);
+        static String number(Int8 number);
 
-    private:
+        /*! \brief Create a String from a number
+         *
+         * \param number The number to represent in the String
+         *
+         * \return Return a String representing the number
+         *
+         */
+        static String number(Int16 number);
+
+        /*! \brief Create a String from a number
+         *
+         * \param number The number to represent in the String
+         *
+         * \return Return a String representing the number
+         *
+         */
+        static String number(Int32 number);
+
+        /*! \brief Create a String from a number
+         *
+         * \param number The number to represent in the String
+         *
+         * \return Return a String representing the number
+         *
+         */
+        static String number(Int64 number);
 
-        struct SharedString;
+        /*! \brief Create a String from a number
+         *
+         * \param number The number to represent in the String
+         *
+         * \return Return a String representing the number
+         *
+         */
+        static String number(Uint8 number);
 
-        /*! \brief Get the instance of SharedString which corresponding to the empty string
+        /*! \brief Create a String from a number
+         *
+         * \param number The number to represent in the String
          *
-         * \return Return the empty SharedString
+         * \return Return a String representing the number
          *
          */
-        static const std::shared_ptr<SharedString>& getEmptyString();
+        static String number(Uint16 number);
+
+        /*! \brief Create a String from a number
+         *
+         * \param number The number to represent in the String
+         *
+         * \return Return a String representing the number
+         *
+         */
+        static String number(Uint32 number);
+
+        /*! \brief Create a String from a number
+         *
+         * \param number The number to represent in the String
+         *
+         * \return Return a String representing the number
+         *
+         */
+        static String number(Uint64 number);
+
+        /*! \brief Create a String from a number
+         *
+         * \param number The number to represent in the String
+         *
+         * \return Return a String representing the number
+         *
+         */
+        static String number(float number);
+
+        /*! \brief Create a String from a number
+         *
+         * \param number The number to represent in the String
+         *
+         * \return Return a String representing the number
+         *
+         */
+        static String number(double number);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(Int8 number, char* buffer);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(Int16 number, char* buffer);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(Int32 number, char* buffer);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(Int64 number, char* buffer);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(Uint8 number, char* buffer);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(Uint16 number, char* buffer);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(Uint32 number, char* buffer);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(Uint64 number, char* buffer);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(float number, char* buffer);
+
+        /*! \brief Write a number in a buffer without allocating
+         *
+         * \param number The number to write
+         * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+         *
+         * \return Return the number of characters written, without the null character ending the buffer
+         *
+         */
+        static std::size_t number(double number, char* buffer);
+
+        /*! \brief Parse a list of numbers separated by a delimiter
+         *
+         * Whitespace around the numbers is ignored, parsing stops at the first invalid number
+         *
+         * \param string    The text to parse
+         * \param delimiter The character between two numbers
+         * \param numbers   The vector to append the numbers to
+         *
+         * \return Return the number of values appended, with the number of characters consumed and the first error
+         *
+         */
+        static ParseResult<std::size_t> parseNumbers(const StringView& string, char delimiter, std::vector<Int64>& numbers);
+
+        /*! \brief Parse a list of numbers separated by a delimiter
+         *
+         * Whitespace around the numbers is ignored, parsing stops at the first invalid number
+         *
+         * \param string    The text to parse
+         * \param delimiter The character between two numbers
+         * \param numbers   The vector to append the numbers to
+         *
+         * \return Return the number of values appended, with the number of characters consumed and the first error
+         *
+         */
+        static ParseResult<std::size_t> parseNumbers(const StringView& string, char delimiter, std::vector<Uint64>& numbers);
+
+        /*! \brief Parse a list of numbers separated by a delimiter
+         *
+         * Whitespace around the numbers is ignored, parsing stops at the first invalid number
+         *
+         * \param string    The text to parse
+         * \param delimiter The character between two numbers
+         * \param numbers   The vector to append the numbers to
+         *
+         * \return Return the number of values appended, with the number of characters consumed and the first error
+         *
+         */
+        static ParseResult<std::size_t> parseNumbers(const StringView& string, char delimiter, std::vector<float>& numbers);
+
+        /*! \brief Parse a list of numbers separated by a delimiter
+         *
+         * Whitespace around the numbers is ignored, parsing stops at the first invalid number
+         *
+         * \param string    The text to parse
+         * \param delimiter The character between two numbers
+         * \param numbers   The vector to append the numbers to
+         *
+         * \return Return the number of values appended, with the number of characters consumed and the first error
+         *
+         */
+        static ParseResult<std::size_t> parseNumbers(const StringView& string, char delimiter, std::vector<double>& numbers);
+
+        /*! \brief Create a String from UTF-32
+         *
+         * \param codePoints The code points to convert
+         * \param count      The number of code points
+         *
+         * \return Return the String in UTF-8, each invalid code point gives U+FFFD
+         *
+         */
+        static String fromUtf32(const Uint32* codePoints, std::size_t count);
+
+        /*! \brief Create a String from UTF-32
+         *
+         * \param codePoints The code points to convert
+         *
+         * \return Return the String in UTF-8, each invalid code point gives U+FFFD
+         *
+         */
+        static String fromUtf32(const std::vector<Uint32>& codePoints);
 
     public:
 
@@ -110,6 +386,54 @@ namespace Bull
          */
         String(const char* string, std::size_t size);
 
+        /*! \brief Constructor
+         *
+         * The characters are always stored in a block of the MemoryResource, which the String
+         * keeps using when it grows, even when they could fit in the inline buffer
+         *
+         * \param string   The string to copy
+         * \param resource The MemoryResource to allocate from, it must outlive the String
+         *
+         */
+        String(const StringView& string, MemoryResource& resource);
+
+        /*! \brief Copy constructor
+         *
+         * \param copy The String to copy
+         *
+         */
+        String(const String& copy);
+
+        /*! \brief Move constructor
+         *
+         * \param move The String to move, it becomes empty
+         *
+         */
+        String(String&& move) noexcept;
+
+        /*! \brief Destructor
+         *
+         */
+        ~String();
+
+        /*! \brief Basic assignment operator
+         *
+         * \param copy The String to copy
+         *
+         * \return Return this after the copy
+         *
+         */
+        String& operator=(const String& copy);
+
+        /*! \brief Move assignment operator
+         *
+         * \param move The String to move, it becomes empty
+         *
+         * \return Return this after the move
+         *
+         */
+        String& operator=(String&& move) noexcept;
+
         /*! \brief Counts occurrences of a character in the string
          *
          * \param character     The character to count
@@ -131,6 +455,16 @@ namespace Bull
          */
         String subString(std::size_t start, std::size_t stop = String::npos) const;
 
+        /*! \brief Get a view on a subpart of the string without copying it
+         *
+         * \param start The index where the substring begins
+         * \param stop  The index where the substring ends
+         *
+         * \return Return the view on the substring, valid until the string is modified or destroyed
+         *
+         */
+        StringView subView(std::size_t start, std::size_t stop = String::npos) const;
+
         /*! \brief Check whether a String start with a specified string
          *
          * \param string The string to test
@@ -138,7 +472,7 @@ namespace Bull
          * \return Return true if this string start with string, false otherwise
          *
          */
-        bool startWith(const String& string);
+        bool startWith(const StringView& string) const;
 
         /*! \brief Check whether a String end with a specified string
          *
@@ -147,7 +481,121 @@ namespace Bull
          * \return Return true if this string end with string, false otherwise
          *
          */
-        bool endWith(const String& string);
+        bool endWith(const StringView& string) const;
+
+        /*! \brief Check whether the string start with a specified string, ignoring the case of ASCII letters
+         *
+         * \param string The string to test
+         *
+         * \return Return true if this string start with string, false otherwise
+         *
+         */
+        bool startWithIgnoreCase(const StringView& string) const;
+
+        /*! \brief Check whether the string end with a specified string, ignoring the case of ASCII letters
+         *
+         * \param string The string to test
+         *
+         * \return Return true if this string end with string, false otherwise
+         *
+         */
+        bool endWithIgnoreCase(const StringView& string) const;
+
+        /*! \brief Find the first occurrence of a character
+         *
+         * \param character The character to find
+         * \param start     The index to start the search
+         *
+         * \return Return the index of the occurrence, npos if there is none
+         *
+         */
+        std::size_t find(char character, std::size_t start = 0) const;
+
+        /*! \brief Find the first occurrence of a string
+         *
+         * \param string The string to find
+         * \param start  The index to start the search
+         *
+         * \return Return the index where the occurrence begins, npos if there is none
+         *
+         */
+        std::size_t find(const StringView& string, std::size_t start = 0) const;
+
+        /*! \brief Find the last occurrence of a character
+         *
+         * \param character The character to find
+         * \param start     The last index where the occurrence can be
+         *
+         * \return Return the index of the occurrence, npos if there is none
+         *
+         */
+        std::size_t rfind(char character, std::size_t start = String::npos) const;
+
+        /*! \brief Find the last occurrence of a string
+         *
+         * \param string The string to find
+         * \param start  The last index where the occurrence can begin
+         *
+         * \return Return the index where the occurrence begins, npos if there is none
+         *
+         */
+        std::size_t rfind(const StringView& string, std::size_t start = String::npos) const;
+
+        /*! \brief Check whether the string contains a character
+         *
+         * \param character The character to find
+         *
+         * \return Return true if the character is in the string, false otherwise
+         *
+         */
+        bool contains(char character) const;
+
+        /*! \brief Check whether the string contains a string
+         *
+         * \param string The string to find
+         *
+         * \return Return true if the string is in the string, false otherwise
+         *
+         */
+        bool contains(const StringView& string) const;
+
+        /*! \brief Replace every occurrence of a string
+         *
+         * \param pattern     The string to replace, occurrences do not overlap
+         * \param replacement The string to put instead
+         *
+         * \return Return this after the replacement
+         *
+         */
+        String& replaceAll(const StringView& pattern, const StringView& replacement);
+
+        /*! \brief Check whether the string is valid UTF-8
+         *
+         * \return Return true if the string is valid UTF-8, false otherwise
+         *
+         */
+        bool isValidUtf8() const;
+
+        /*! \brief Get the number of code points in the string, which must be valid UTF-8
+         *
+         * \return Return the number of code points
+         *
+         */
+        std::size_t getCodePointCount() const;
+
+        /*! \brief Iterate lazily over the code points of the string
+         *
+         * \return Return a range over the code points, valid until the string is modified or destroyed
+         *
+         */
+        StringView::CodePoints codePoints() const;
+
+        /*! \brief Convert the string from UTF-8 to UTF-32
+         *
+         * \return Return the code points, each invalid byte gives U+FFFD
+         *
+         */
+        std::vector<Uint32> toUtf32() const;
 
         /*! \brief Splits a string into others
          *
@@ -158,6 +606,24 @@ namespace Bull
          */
         std::vector<String> explode(char delimiter) const;
 
+        /*! \brief Splits a string into views without copying the tokens
+         *
+         * \param delimiter The character between two split strings
+         *
+         * \return Return the splits, valid until the string is modified or destroyed
+         *
+         */
+        std::vector<StringView> explodeView(char delimiter) const;
+
+        /*! \brief Splits a string lazily
+         *
+         * \param delimiter The character between two split strings
+         *
+         * \return Return a range over the splits, valid until the string is modified or destroyed
+         *
+         */
+        StringView::Split split(char delimiter) const;
+
         /*! \brief Set the string in uppercase
          *
          * \param start The index to start to set characters in uppercase
@@ -214,6 +680,11 @@ namespace Bull
          */
         void reserve(std::size_t capacity);
 
+        /*! \brief Reduce the capacity of the string to its size
+         *
+         */
+        void shrinkToFit();
+
         /*! \brief Get the capacity of the string
          *
          * \return Return the capacity of the string
@@ -221,6 +692,13 @@ namespace Bull
          */
         std::size_t getCapacity() const;
 
+        /*! \brief Get the MemoryResource the string allocates from
+         *
+         * \return Return the MemoryResource, the default one when the string uses the global heap
+         *
+         */
+        MemoryResource& getMemoryResource() const;
+
         /*! \brief Check whether the string is empty
          *
          * \return Return true if the string is empty, false otherwise
@@ -239,7 +717,7 @@ namespace Bull
          *
          * \param index The index of the character to get
          *
-         * \return Return the character at the ith position
+         * \return Return the character at the ith position, the string is detached from its copies first
          *
          */
         char& operator[](std::size_t index);
@@ -260,6 +738,77 @@ namespace Bull
          */
         int toInt() const;
 
+        /*! \brief Parse the beginning of the string as a signed 64 bits integer
+         *
+         * \return Return the value with the number of characters used, or the reason of the failure
+         *
+         */
+        ParseResult<Int64> toInt64() const;
+
+        /*! \brief Parse the beginning of the string as an unsigned 64 bits integer
+         *
+         * \return Return the value with the number of characters used, or the reason of the failure
+         *
+         */
+        ParseResult<Uint64> toUint64() const;
+
+        /*! \brief Parse the beginning of the string as a float
+         *
+         * \return Return the value with the number of characters used, or the reason of the failure
+         *
+         */
+        ParseResult<float> toFloat() const;
+
+        /*! \brief Parse the beginning of the string as a double
+         *
+         * \return Return the value with the number of characters used, or the reason of the failure
+         *
+         */
+        ParseResult<double> toDouble() const;
+
+        /*! \brief Compare the string with another one in lexicographic order
+         *
+         * \param string The string to compare with
+         *
+         * \return Return a negative value if this is before string, 0 if they are equal, a positive value otherwise
+         *
+         */
+        int compare(const StringView& string) const;
+
+        /*! \brief Get the hash of the string
+         *
+         * The hash of a long string is cached in its buffer and shared between its copies
+         *
+         * \return Return the hash of the string
+         *
+         */
+        std::size_t getHash() const;
+
+        /*! \brief Check whether the string is equal to another string, ignoring the case of ASCII letters
+         *
+         * \param string The string to compare with
+         *
+         * \return Return true if they are equal once their ASCII letters are in lowercase, false otherwise
+         *
+         */
+        bool equalsIgnoreCase(const StringView& string) const;
+
+        /*! \brief Compare the string with another string in lexicographic order, ignoring the case of ASCII letters
+         *
+         * \param string The string to compare with
+         *
+         * \return Return a negative value if this is before string, 0 if they are equal, a positive value otherwise
+         *
+         */
+        int compareIgnoreCase(const StringView& string) const;
+
+        /*! \brief Get the hash of the string ignoring the case of ASCII letters
+         *
+         * \return Return the same hash as getHash on the string set in lowercase, without copying it
+         *
+         */
+        std::size_t getHashIgnoreCase() const;
+
         /*! \brief Compare two Strings
          *
          * \param left The first String to compare
@@ -320,6 +869,36 @@ namespace Bull
          */
         friend bool operator!=(const String& left, const char* right);
 
+        /*! \brief Order two Strings
+         *
+         * \param left The first String to compare
+         * \param right The second String to compare
+         *
+         * \return Return true if left is before right in lexicographic order, false otherwise
+         *
+         */
+        friend bool operator<(const String& left, const String& right);
+
+        /*! \brief Order two Strings
+         *
+         * \param left The first String to compare
+         * \param right The second String to compare
+         *
+         * \return Return true if left is before right in lexicographic order, false otherwise
+         *
+         */
+        friend bool operator<(const char* left, const String& right);
+
+        /*! \brief Order two Strings
+         *
+         * \param left The first String to compare
+         * \param right The second String to compare
+         *
+         * \return Return true if left is before right in lexicographic order, false otherwise
+         *
+         */
+        friend bool operator<(const String& left, const char* right);
+
         /*! \brief Concatenates two Strings
          *
          * \param left  The left part of the final String
@@ -330,6 +909,36 @@ namespace Bull
          */
         friend String operator+(const String& left, const String& right);
 
+        /*! \brief Concatenates two Strings, reusing the storage of left
+         *
+         * \param left  The left part of the final String
+         * \param right The right part of the final String
+         *
+         * \return Return the concatenated String
+         *
+         */
+        friend String operator+(String&& left, const String& right);
+
+        /*! \brief Concatenates two Strings, reusing the storage of right
+         *
+         * \param left  The left part of the final String
+         * \param right The right part of the final String
+         *
+         * \return Return the concatenated String
+         *
+         */
+        friend String operator+(const String& left, String&& right);
+
+        /*! \brief Concatenates two Strings, reusing the storage of left
+         *
+         * \param left  The left part of the final String
+         * \param right The right part of the final String
+         *
+         * \return Return the concatenated String
+         *
+         */
+        friend String operator+(String&& left, String&& right);
+
         /*! \brief Concatenates a String at the end of the string
          *
          * \param right The String to add
@@ -341,18 +950,178 @@ namespace Bull
 
     private:
 
+        friend struct prv::FormatEngine;
+
+        friend class StringStream;
+
+        friend struct Encoding;
+
+        /*! \brief Check whether the string is stored in the inline buffer
+         *
+         * \return Return true if the string does not use a shared buffer, false otherwise
+         *
+         */
+        bool isSmall() const;
+
+        /*! \brief Check whether the storage of the string can be modified without affecting other Strings
+         *
+         * \return Return true if the string is small or the only owner of its SharedString, false otherwise
+         *
+         */
+        bool isUniquelyOwned() const;
+
+        /*! \brief Get the characters of the string
+         *
+         * \return Return a pointer to the first character of the string
+         *
+         */
+        char* getData();
+
+        /*! \brief Get the characters of the string
+         *
+         * \return Return a constant pointer to the first character of the string
+         *
+         */
+        const char* getData() const;
+
+        /*! \brief Header of a heap allocated string, its characters are stored right after it
+         *
+         */
         struct SharedString
         {
-            SharedString();
-            SharedString(std::size_t size);
-            SharedString(std::size_t size, std::size_t capacity);
+            /*! \brief Allocate a SharedString and its characters in a single block
+             *
+             * \param size     The size of the string
+             * \param capacity The number of characters the block can hold
+             * \param resource The MemoryResource to allocate from, nullptr to use the global heap
+             *
+             * \return Return the SharedString created, with a single reference
+             *
+             */
+            static SharedString* create(std::size_t size, std::size_t capacity, MemoryResource* resource = nullptr);
+
+            /*! \brief Constructor
+             *
+             * \param size     The size of the string
+             * \param capacity The number of characters the block can hold
+             * \param resource The MemoryResource the block comes from, nullptr for the global heap
+             *
+             */
+            SharedString(std::size_t size, std::size_t capacity, MemoryResource* resource);
 
-            std::size_t             m_size;
-            std::size_t             m_capacity;
-            std::unique_ptr<char[]> m_string;
+            /*! \brief Add a reference to the SharedString
+             *
+             */
+            void acquire();
+
+            /*! \brief Remove a reference to the SharedString and free it when it was the last one
+             *
+             */
+            void release();
+
+            /*! \brief Check whether the SharedString is referenced by a single String
+             *
+             * \return Return true if there is only one reference to the SharedString, false otherwise
+             *
+             */
+            bool isUnique() const;
+
+            /*! \brief Get the characters stored after the header
+             *
+             * \return Return a pointer to the first character
+             *
+             */
+            char* getString();
+
+            std::atomic<std::size_t> m_references;
+            std::size_t              m_size;
+            std::size_t              m_capacity;
+            std::atomic<std::size_t> m_hash;
+            MemoryResource*          m_resource;
         };
 
-        std::shared_ptr<SharedString> m_sharedString;
+        /*! \brief Create a String whose characters are not initialized
+         *
+         * \param size     The size of the String
+         * \param resource The MemoryResource to allocate from, nullptr to use the global heap
+         *
+         * \return Return the String created, with its null character already set
+         *
+         */
+        static String createUninitialized(std::size_t size, MemoryResource* resource = nullptr);
+
+        /*! \brief Get the MemoryResource the SharedString of the string comes from
+         *
+         * \return Return the MemoryResource, nullptr when the string uses the global heap or the inline buffer
+         *
+         */
+        MemoryResource* getResource() const;
+
+        /*! \brief Make the string uniquely owned and able to hold some characters, keeping its content
+         *
+         * \param capacity The number of characters the string must be able to hold
+         *
+         * \return Return a pointer to the characters, which can be written in place
+         *
+         */
+        char* prepareWrite(std::size_t capacity);
+
+        /*! \brief Give the string its own copy of a shared SharedString, with the same content and capacity
+         *
+         */
+        void detach();
+
+        /*! \brief Get the characters of the string to modify them in place
+         *
+         * \return Return a pointer to the characters, owned by this string only
+         *
+         */
+        char* getMutableData();
+
+        /*! \brief Change the size of a uniquely owned string without touching its characters
+         *
+         * \param size The new size, not above the capacity
+         *
+         */
+        void setSizeInPlace(std::size_t size);
+
+        /*! \brief Forget the cached hash before the characters are modified in place
+         *
+         */
+        void resetHash();
+
+        /*! \brief Replace the storage of the string by a SharedString
+         *
+         * \param sharedString The SharedString to use, this takes ownership of its reference
+         *
+         */
+        void setSharedString(SharedString* sharedString);
+
+        static constexpr std::size_t GrowthFactor = 2; /*!< How much the capacity is multiplied when an owned buffer is full */
+
+        static constexpr Uint8 LargeSize = 0xFF; /*!< Value of m_smallSize when the string uses a SharedString */
+
+        union
+        {
+            SharedString* m_sharedString; /*!< Only used when the string is longer than SmallCapacity */
+            char          m_smallString[SmallCapacity + 1];
+        };
+
+        Uint8 m_smallSize;
+    };
+}
+
+#include <Bull/Core/String.inl>
+
+namespace std
+{
+    template<>
+    struct hash<Bull::String>
+    {
+        std::size_t operator()(const Bull::String& string) const
+        {
+            return string.getHash();
+        }
     };
 }
 
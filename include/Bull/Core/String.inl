@@ -0,0 +1,15 @@
+namespace Bull
+{
+    /*! \brief Concatenate strings with a single allocation
+     *
+     * \param parts The strings to concatenate, anything a StringView can be created from
+     *
+     * \return Return the concatenated String
+     *
+     */
+    template <typename... Parts>
+    String String::concat(const Parts&... parts)
+    {
+        return String::concat({StringView(parts)...});
+    }
+}
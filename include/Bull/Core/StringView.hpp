@@ -0,0 +1,492 @@
+#ifndef Bull_StringView_hpp
+#define Bull_StringView_hpp
+
+#include <cstddef>
+#include <vector>
+
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/System/Export.hpp>
+
+namespace Bull
+{
+    class String;
+
+    class BULL_API StringView
+    {
+    public:
+
+        static constexpr std::size_t npos = -1;
+
+        class Split;
+
+        class CodePoints;
+
+    public:
+
+        /*! \brief Default constructor
+         *
+         */
+        StringView();
+
+        /*! \brief Constructor
+         *
+         * \param string The null terminated string to look at
+         *
+         */
+        StringView(const char* string);
+
+        /*! \brief Constructor
+         *
+         * \param string The characters to look at
+         * \param size   The number of characters
+         *
+         */
+        StringView(const char* string, std::size_t size);
+
+        /*! \brief Constructor
+         *
+         * \param string The String to look at, it must outlive the StringView
+         *
+         */
+        StringView(const String& string);
+
+        /*! \brief Get a subpart of the view, following the same rules as String::subString
+         *
+         * \param start The index where the subpart begins
+         * \param stop  The index where the subpart ends
+         *
+         * \return Return the view on the subpart
+         *
+         */
+        StringView subView(std::size_t start, std::size_t stop = StringView::npos) const;
+
+        /*! \brief Check whether the view start with a specified string
+         *
+         * \param string The string to test
+         *
+         * \return Return true if this view start with string, false otherwise
+         *
+         */
+        bool startWith(const StringView& string) const;
+
+        /*! \brief Check whether the view end with a specified string
+         *
+         * \param string The string to test
+         *
+         * \return Return true if this view end with string, false otherwise
+         *
+         */
+        bool endWith(const StringView& string) const;
+
+        /*! \brief Check whether the view start with a specified string, ignoring the case of ASCII letters
+         *
+         * \param string The string to test
+         *
+         * \return Return true if this view start with string, false otherwise
+         *
+         */
+        bool startWithIgnoreCase(const StringView& string) const;
+
+        /*! \brief Check whether the view end with a specified string, ignoring the case of ASCII letters
+         *
+         * \param string The string to test
+         *
+         * \return Return true if this view end with string, false otherwise
+         *
+         */
+        bool endWithIgnoreCase(const StringView& string) const;
+
+        /*! \brief Check whether the view is equal to another string, ignoring the case of ASCII letters
+         *
+         * \param string The string to compare with
+         *
+         * \return Return true if they are equal once their ASCII letters are in lowercase, false otherwise
+         *
+         */
+        bool equalsIgnoreCase(const StringView& string) const;
+
+        /*! \brief Compare the view with another string in lexicographic order, ignoring the case of ASCII letters
+         *
+         * \param string The string to compare with
+         *
+         * \return Return a negative value if this is before string, 0 if they are equal, a positive value otherwise
+         *
+         */
+        int compareIgnoreCase(const StringView& string) const;
+
+        /*! \brief Get the hash of the view ignoring the case of ASCII letters
+         *
+         * \return Return the same hash as getHash on the view set in lowercase, without copying it
+         *
+         */
+        std::size_t getHashIgnoreCase() const;
+
+        /*! \brief Find the first occurrence of a character
+         *
+         * \param character The character to find
+         * \param start     The index to start the search
+         *
+         * \return Return the index of the occurrence, npos if there is none
+         *
+         */
+        std::size_t find(char character, std::size_t start = 0) const;
+
+        /*! \brief Find the first occurrence of a string
+         *
+         * \param string The string to find
+         * \param start  The index to start the search
+         *
+         * \return Return the index where the occurrence begins, npos if there is none
+         *
+         */
+        std::size_t find(const StringView& string, std::size_t start = 0) const;
+
+        /*! \brief Find the last occurrence of a character
+         *
+         * \param character The character to find
+         * \param start     The last index where the occurrence can be
+         *
+         * \return Return the index of the occurrence, npos if there is none
+         *
+         */
+        std::size_t rfind(char character, std::size_t start = StringView::npos) const;
+
+        /*! \brief Find the last occurrence of a string
+         *
+         * \param string The string to find
+         * \param start  The last index where the occurrence can begin
+         *
+         * \return Return the index where the occurrence begins, npos if there is none
+         *
+         */
+        std::size_t rfind(const StringView& string, std::size_t start = StringView::npos) const;
+
+        /*! \brief Check whether the view contains a character
+         *
+         * \param character The character to find
+         *
+         * \return Return true if the character is in the view, false otherwise
+         *
+         */
+        bool contains(char character) const;
+
+        /*! \brief Check whether the view contains a string
+         *
+         * \param string The string to find
+         *
+         * \return Return true if the string is in the view, false otherwise
+         *
+         */
+        bool contains(const StringView& string) const;
+
+        /*! \brief Split the view lazily
+         *
+         * \param delimiter The character between two tokens
+         *
+         * \return Return a range over the tokens, with the same tokens as String::explode
+         *
+         */
+        Split split(char delimiter) const;
+
+        /*! \brief Check whether the view is valid UTF-8
+         *
+         * \return Return true if the view is valid UTF-8, false otherwise
+         *
+         */
+        bool isValidUtf8() const;
+
+        /*! \brief Get the number of code points in the view, which must be valid UTF-8
+         *
+         * \return Return the number of code points
+         *
+         */
+        std::size_t getCodePointCount() const;
+
+        /*! \brief Iterate lazily over the code points of the view
+         *
+         * \return Return a range over the code points, each invalid byte gives U+FFFD
+         *
+         */
+        CodePoints codePoints() const;
+
+        /*! \brief Convert the view from UTF-8 to UTF-32
+         *
+         * \return Return the code points, each invalid byte gives U+FFFD
+         *
+         */
+        std::vector<Uint32> toUtf32() const;
+
+        /*! \brief Copy the viewed characters into a String
+         *
+         * \return Return the String created
+         *
+         */
+        String toString() const;
+
+        /*! \brief Get the viewed characters
+         *
+         * \return Return a pointer to the first character, not necessarily null terminated
+         *
+         */
+        const char* getData() const;
+
+        /*! \brief Get the size of the view
+         *
+         * \return Return the number of characters in the view
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Check whether the view is empty
+         *
+         * \return Return true if the view is empty, false otherwise
+         *
+         */
+        bool isEmpty() const;
+
+        /*! \brief Get the ith character of the view
+         *
+         * \param index The index of the character to get
+         *
+         * \return Return the character at the ith position
+         *
+         */
+        const char& operator[](std::size_t index) const;
+
+        /*! \brief Compare two StringViews
+         *
+         * \param left  The first StringView to compare
+         * \param right The second StringView to compare
+         *
+         * \return Return true if left and right are equal, false otherwise
+         *
+         */
+        friend bool operator==(const StringView& left, const StringView& right);
+
+        /*! \brief Compare two StringViews
+         *
+         * \param left  The first StringView to compare
+         * \param right The second StringView to compare
+         *
+         * \return Return true if left and right are not equal, false otherwise
+         *
+         */
+        friend bool operator!=(const StringView& left, const StringView& right);
+
+    private:
+
+        const char* m_string;
+        std::size_t m_size;
+    };
+
+    class BULL_API StringView::Split
+    {
+    public:
+
+        class BULL_API Iterator
+        {
+        public:
+
+            /*! \brief Constructor
+             *
+             * \param split    The Split to iterate over
+             * \param position The index of the beginning of the current token
+             *
+             */
+            Iterator(const Split& split, std::size_t position);
+
+            /*! \brief Get the current token
+             *
+             * \return Return the current token
+             *
+             */
+            const StringView& operator*() const;
+
+            /*! \brief Get the current token
+             *
+             * \return Return a pointer to the current token
+             *
+             */
+            const StringView* operator->() const;
+
+            /*! \brief Move to the next token
+             *
+             * \return Return this after the move
+             *
+             */
+            Iterator& operator++();
+
+            /*! \brief Compare two Iterators
+             *
+             * \param right The Iterator to compare with this
+             *
+             * \return Return true if this and right are on the same token, false otherwise
+             *
+             */
+            bool operator==(const Iterator& right) const;
+
+            /*! \brief Compare two Iterators
+             *
+             * \param right The Iterator to compare with this
+             *
+             * \return Return true if this and right are not on the same token, false otherwise
+             *
+             */
+            bool operator!=(const Iterator& right) const;
+
+        private:
+
+            const Split* m_split;
+            std::size_t  m_position;
+            std::size_t  m_next;
+            StringView   m_token;
+        };
+
+    public:
+
+        /*! \brief Constructor
+         *
+         * \param string    The characters to split
+         * \param delimiter The character between two tokens
+         *
+         */
+        Split(const StringView& string, char delimiter);
+
+        /*! \brief Get the next token
+         *
+         * \param token The StringView to fill with the token
+         *
+         * \return Return true if a token was found, false at the end of the string
+         *
+         */
+        bool next(StringView& token);
+
+        /*! \brief Get an Iterator on the first token
+         *
+         * \return Return the Iterator
+         *
+         */
+        Iterator begin() const;
+
+        /*! \brief Get an Iterator past the last token
+         *
+         * \return Return the Iterator
+         *
+         */
+        Iterator end() const;
+
+    private:
+
+        /*! \brief Find the token beginning at a position
+         *
+         * \param position The index where the token begins
+         * \param token    The StringView to fill with the token
+         *
+         * \return Return the index where the next token begins, StringView::npos if there is no token at position
+         *
+         */
+        std::size_t findToken(std::size_t position, StringView& token) const;
+
+        StringView  m_string;
+        char        m_delimiter;
+        std::size_t m_position;
+    };
+
+    class BULL_API StringView::CodePoints
+    {
+    public:
+
+        class BULL_API Iterator
+        {
+        public:
+
+            /*! \brief Constructor
+             *
+             * \param string   The characters to decode
+             * \param position The index of the beginning of the current code point
+             *
+             */
+            Iterator(const StringView& string, std::size_t position);
+
+            /*! \brief Get the current code point
+             *
+             * \return Return the current code point, U+FFFD if it is not valid UTF-8
+             *
+             */
+            Uint32 operator*() const;
+
+            /*! \brief Move to the next code point
+             *
+             * \return Return this after the move
+             *
+             */
+            Iterator& operator++();
+
+            /*! \brief Get the index of the current code point
+             *
+             * \return Return the index of the first character of the current code point
+             *
+             */
+            std::size_t getPosition() const;
+
+            /*! \brief Compare two Iterators
+             *
+             * \param right The Iterator to compare with this
+             *
+             * \return Return true if this and right are on the same code point, false otherwise
+             *
+             */
+            bool operator==(const Iterator& right) const;
+
+            /*! \brief Compare two Iterators
+             *
+             * \param right The Iterator to compare with this
+             *
+             * \return Return true if this and right are not on the same code point, false otherwise
+             *
+             */
+            bool operator!=(const Iterator& right) const;
+
+        private:
+
+            /*! \brief Decode the code point at the current position
+             *
+             */
+            void decode();
+
+            StringView  m_string;
+            std::size_t m_position;
+            std::size_t m_length;
+            Uint32      m_codePoint;
+        };
+
+    public:
+
+        /*! \brief Constructor
+         *
+         * \param string The characters to decode
+         *
+         */
+        explicit CodePoints(const StringView& string);
+
+        /*! \brief Get an Iterator on the first code point
+         *
+         * \return Return the Iterator
+         *
+         */
+        Iterator begin() const;
+
+        /*! \brief Get an Iterator past the last code point
+         *
+         * \return Return the Iterator
+         *
+         */
+        Iterator end() const;
+
+    private:
+
+        StringView m_string;
+    };
+}
+
+#endif // Bull_StringView_hpp
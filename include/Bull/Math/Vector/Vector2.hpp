@@ -3,6 +3,7 @@
 
 #include <cmath>
 
+#include <Bull/Core/Format.hpp>
 #include <Bull/Core/System/Export.hpp>
 
 namespace Bull
@@ -168,6 +169,38 @@ namespace Bull
     template<typename TComponent>
     Vector2<TComponent> operator-(const Vector2<TComponent>& left, float right);
 
+    template<typename TComponent>
+    struct Formatter<Vector2<TComponent>>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The Vector2 to write, as ({}, {})
+         *
+         */
+        explicit Formatter(const Vector2<TComponent>& value);
+
+        /*! \brief Get the number of characters to write
+         *
+         * \return Return the number of characters
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Write the Vector2
+         *
+         * \param output The buffer to write in, it must hold getSize() characters
+         *
+         */
+        void write(char* output) const;
+
+    private:
+
+        static_assert(std::is_arithmetic<TComponent>::value, "Vector2 components must be numbers to be formatted");
+
+        char        m_buffer[2 * String::NumberCapacity + 4];
+        std::size_t m_size;
+    };
+
     typedef Vector2<float> Vector2F;
     typedef Vector2<int> Vector2I;
     typedef Vector2<unsigned int> Vector2UI;
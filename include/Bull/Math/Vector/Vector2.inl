@@ -218,4 +218,37 @@ namespace Bull
     {
         return Vector2<TComponent>(left) -= Vector2<TComponent>(right);
     }
+
+    /*! \brief Constructor
+     *
+     * \param value The Vector2 to write, as ({}, {})
+     *
+     */
+    template<typename TComponent>
+    Formatter<Vector2<TComponent>>::Formatter(const Vector2<TComponent>& value)
+    {
+        m_size = formatTo(m_buffer, sizeof(m_buffer), "({}, {})", value.x, value.y);
+    }
+
+    /*! \brief Get the number of characters to write
+     *
+     * \return Return the number of characters
+     *
+     */
+    template<typename TComponent>
+    std::size_t Formatter<Vector2<TComponent>>::getSize() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Write the Vector2
+     *
+     * \param output The buffer to write in, it must hold getSize() characters
+     *
+     */
+    template<typename TComponent>
+    void Formatter<Vector2<TComponent>>::write(char* output) const
+    {
+        std::memcpy(output, m_buffer, m_size);
+    }
 }
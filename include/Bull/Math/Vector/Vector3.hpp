@@ -3,6 +3,7 @@
 
 #include <cmath>
 
+#include <Bull/Core/Format.hpp>
 #include <Bull/Core/System/Export.hpp>
 
 #include <Bull/Math/Vector/Vector2.hpp>
@@ -179,6 +180,38 @@ namespace Bull
     template<typename TComponent>
     Vector3<TComponent> operator-(const Vector3<TComponent>& left, float right);
 
+    template<typename TComponent>
+    struct Formatter<Vector3<TComponent>>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The Vector3 to write, as ({}, {}, {})
+         *
+         */
+        explicit Formatter(const Vector3<TComponent>& value);
+
+        /*! \brief Get the number of characters to write
+         *
+         * \return Return the number of characters
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Write the Vector3
+         *
+         * \param output The buffer to write in, it must hold getSize() characters
+         *
+         */
+        void write(char* output) const;
+
+    private:
+
+        static_assert(std::is_arithmetic<TComponent>::value, "Vector3 components must be numbers to be formatted");
+
+        char        m_buffer[3 * String::NumberCapacity + 6];
+        std::size_t m_size;
+    };
+
     typedef Vector3<float> Vector3F;
     typedef Vector3<int> Vector3I;
     typedef Vector3<unsigned int> Vector3UI;
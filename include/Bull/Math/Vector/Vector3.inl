@@ -249,4 +249,37 @@ namespace Bull
     {
         return Vector3<TComponent>(left) -= Vector3<TComponent>(right);
     }
+
+    /*! \brief Constructor
+     *
+     * \param value The Vector3 to write, as ({}, {}, {})
+     *
+     */
+    template<typename TComponent>
+    Formatter<Vector3<TComponent>>::Formatter(const Vector3<TComponent>& value)
+    {
+        m_size = formatTo(m_buffer, sizeof(m_buffer), "({}, {}, {})", value.x, value.y, value.z);
+    }
+
+    /*! \brief Get the number of characters to write
+     *
+     * \return Return the number of characters
+     *
+     */
+    template<typename TComponent>
+    std::size_t Formatter<Vector3<TComponent>>::getSize() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Write the Vector3
+     *
+     * \param output The buffer to write in, it must hold getSize() characters
+     *
+     */
+    template<typename TComponent>
+    void Formatter<Vector3<TComponent>>::write(char* output) const
+    {
+        std::memcpy(output, m_buffer, m_size);
+    }
 }
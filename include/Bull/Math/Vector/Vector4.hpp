@@ -3,6 +3,7 @@
 
 #include <cmath>
 
+#include <Bull/Core/Format.hpp>
 #include <Bull/Core/System/Export.hpp>
 
 #include <Bull/Math/Vector/Vector3.hpp>
@@ -180,6 +181,38 @@ namespace Bull
     template<typename TComponent>
     Vector4<TComponent> operator-(const Vector4<TComponent>& left, float right);
 
+    template<typename TComponent>
+    struct Formatter<Vector4<TComponent>>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The Vector4 to write, as ({}, {}, {}, {})
+         *
+         */
+        explicit Formatter(const Vector4<TComponent>& value);
+
+        /*! \brief Get the number of characters to write
+         *
+         * \return Return the number of characters
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Write the Vector4
+         *
+         * \param output The buffer to write in, it must hold getSize() characters
+         *
+         */
+        void write(char* output) const;
+
+    private:
+
+        static_assert(std::is_arithmetic<TComponent>::value, "Vector4 components must be numbers to be formatted");
+
+        char        m_buffer[4 * String::NumberCapacity + 8];
+        std::size_t m_size;
+    };
+
     typedef Vector4<float> Vector4F;
     typedef Vector4<int> Vector4I;
     typedef Vector4<unsigned int> Vector4UI;
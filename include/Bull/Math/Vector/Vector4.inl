@@ -256,4 +256,37 @@ namespace Bull
     {
         return Vector4<TComponent>(left) -= Vector4<TComponent>(right);
     }
+
+    /*! \brief Constructor
+     *
+     * \param value The Vector4 to write, as ({}, {}, {}, {})
+     *
+     */
+    template<typename TComponent>
+    Formatter<Vector4<TComponent>>::Formatter(const Vector4<TComponent>& value)
+    {
+        m_size = formatTo(m_buffer, sizeof(m_buffer), "({}, {}, {}, {})", value.x, value.y, value.z, value.w);
+    }
+
+    /*! \brief Get the number of characters to write
+     *
+     * \return Return the number of characters
+     *
+     */
+    template<typename TComponent>
+    std::size_t Formatter<Vector4<TComponent>>::getSize() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Write the Vector4
+     *
+     * \param output The buffer to write in, it must hold getSize() characters
+     *
+     */
+    template<typename TComponent>
+    void Formatter<Vector4<TComponent>>::write(char* output) const
+    {
+        std::memcpy(output, m_buffer, m_size);
+    }
 }
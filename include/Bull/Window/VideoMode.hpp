@@ -3,6 +3,7 @@
 
 #include <vector>
 
+#include <Bull/Core/Format.hpp>
 #include <Bull/Core/System/Export.hpp>
 #include <Bull/Core/Integer.hpp>
 
@@ -69,6 +70,36 @@ namespace Bull
 
         Uint8 bitsPerPixel;  /*!< The the number of bits per pixel to create colors */
     };
+
+    template <>
+    struct BULL_API Formatter<VideoMode>
+    {
+        /*! \brief Constructor
+         *
+         * \param value The VideoMode to write, as widthxheightxbitsPerPixel
+         *
+         */
+        explicit Formatter(const VideoMode& value);
+
+        /*! \brief Get the number of characters to write
+         *
+         * \return Return the number of characters
+         *
+         */
+        std::size_t getSize() const;
+
+        /*! \brief Write the VideoMode
+         *
+         * \param output The buffer to write in, it must hold getSize() characters
+         *
+         */
+        void write(char* output) const;
+
+    private:
+
+        char        m_buffer[3 * String::NumberCapacity];
+        std::size_t m_size;
+    };
 }
 
 #endif // Bull_VideoMode_hpp
@@ -0,0 +1,250 @@
+#include <utility>
+
+#include <Bull/Core/Encoding.hpp>
+#include <Bull/Core/Simd/EncodingKernels.hpp>
+
+namespace Bull
+{
+    /*! \brief Get the number of characters needed to encode bytes
+     *
+     * \param size   The number of bytes to encode
+     * \param scheme The Scheme to encode with
+     *
+     * \return Return the number of characters
+     *
+     */
+    std::size_t Encoding::getEncodedSize(std::size_t size, Scheme scheme)
+    {
+        return scheme == Base64 ? (size + 2) / 3 * 4 : size * 2;
+    }
+
+    /*! \brief Get the number of bytes needed to decode characters
+     *
+     * \param size   The number of characters to decode
+     * \param scheme The Scheme to decode with
+     *
+     * \return Return the number of bytes, padding is not taken into account
+     *
+     */
+    std::size_t Encoding::getDecodedCapacity(std::size_t size, Scheme scheme)
+    {
+        return scheme == Base64 ? size / 4 * 3 : size / 2;
+    }
+
+    /*! \brief Encode bytes in Base64
+     *
+     * \param data The bytes to encode
+     * \param size The number of bytes
+     *
+     * \return Return the encoded String
+     *
+     */
+    String Encoding::toBase64(const void* data, std::size_t size)
+    {
+        return encodeString(data, size, Base64);
+    }
+
+    /*! \brief Encode the characters of a string in Base64
+     *
+     * \param string The characters to encode
+     *
+     * \return Return the encoded String
+     *
+     */
+    String Encoding::toBase64(const StringView& string)
+    {
+        return encodeString(string.getData(), string.getSize(), Base64);
+    }
+
+    /*! \brief Encode bytes in Base64 into a buffer
+     *
+     * \param data   The bytes to encode
+     * \param size   The number of bytes
+     * \param buffer The buffer to fill, it must hold getEncodedSize(size, Base64) characters
+     *
+     * \return Return the number of characters written, no null character is added
+     *
+     */
+    std::size_t Encoding::toBase64(const void* data, std::size_t size, char* buffer)
+    {
+        return encode(data, size, buffer, Base64);
+    }
+
+    /*! \brief Decode Base64 characters
+     *
+     * \param text The characters to decode
+     *
+     * \return Return the decoded bytes, or the index of the first character which can not be decoded
+     *
+     */
+    ParseResult<String> Encoding::fromBase64(const StringView& text)
+    {
+        return decodeString(text, Base64);
+    }
+
+    /*! \brief Decode Base64 characters into a buffer
+     *
+     * \param text   The characters to decode
+     * \param buffer The buffer to fill, it must hold getDecodedCapacity(text.getSize(), Base64) bytes
+     *
+     * \return Return the number of bytes written, or the index of the first character which can not be decoded
+     *
+     */
+    ParseResult<std::size_t> Encoding::fromBase64(const StringView& text, void* buffer)
+    {
+        return decode(text, buffer, Base64);
+    }
+
+    /*! \brief Encode bytes in hexadecimal
+     *
+     * \param data The bytes to encode
+     * \param size The number of bytes
+     *
+     * \return Return the encoded String
+     *
+     */
+    String Encoding::toHex(const void* data, std::size_t size)
+    {
+        return encodeString(data, size, Hex);
+    }
+
+    /*! \brief Encode the characters of a string in hexadecimal
+     *
+     * \param string The characters to encode
+     *
+     * \return Return the encoded String
+     *
+     */
+    String Encoding::toHex(const StringView& string)
+    {
+        return encodeString(string.getData(), string.getSize(), Hex);
+    }
+
+    /*! \brief Encode bytes in hexadecimal into a buffer
+     *
+     * \param data   The bytes to encode
+     * \param size   The number of bytes
+     * \param buffer The buffer to fill, it must hold getEncodedSize(size, Hex) characters
+     *
+     * \return Return the number of characters written, no null character is added
+     *
+     */
+    std::size_t Encoding::toHex(const void* data, std::size_t size, char* buffer)
+    {
+        return encode(data, size, buffer, Hex);
+    }
+
+    /*! \brief Decode hexadecimal characters
+     *
+     * \param text The characters to decode
+     *
+     * \return Return the decoded bytes, or the index of the first character which can not be decoded
+     *
+     */
+    ParseResult<String> Encoding::fromHex(const StringView& text)
+    {
+        return decodeString(text, Hex);
+    }
+
+    /*! \brief Decode hexadecimal characters into a buffer
+     *
+     * \param text   The characters to decode
+     * \param buffer The buffer to fill, it must hold getDecodedCapacity(text.getSize(), Hex) bytes
+     *
+     * \return Return the number of bytes written, or the index of the first character which can not be decoded
+     *
+     */
+    ParseResult<std::size_t> Encoding::fromHex(const StringView& text, void* buffer)
+    {
+        return decode(text, buffer, Hex);
+    }
+
+    /*! \brief Encode bytes into a buffer
+     *
+     * \param data   The bytes to encode
+     * \param size   The number of bytes
+     * \param buffer The buffer to fill, it must hold getEncodedSize(size, scheme) characters
+     * \param scheme The Scheme to encode with
+     *
+     * \return Return the number of characters written, no null character is added
+     *
+     */
+    std::size_t Encoding::encode(const void* data, std::size_t size, char* buffer, Scheme scheme)
+    {
+        const Uint8* bytes = static_cast<const Uint8*>(data);
+
+        if(scheme == Base64)
+        {
+            prv::EncodingKernels::toBase64(bytes, size, buffer);
+        }
+        else
+        {
+            prv::EncodingKernels::toHex(bytes, size, buffer);
+        }
+
+        return getEncodedSize(size, scheme);
+    }
+
+    /*! \brief Decode characters into a buffer
+     *
+     * \param text   The characters to decode
+     * \param buffer The buffer to fill, it must hold getDecodedCapacity(text.getSize(), scheme) bytes
+     * \param scheme The Scheme to decode with
+     *
+     * \return Return the number of bytes written, or the index of the first character which can not be decoded
+     *
+     */
+    ParseResult<std::size_t> Encoding::decode(const StringView& text, void* buffer, Scheme scheme)
+    {
+        Uint8* bytes = static_cast<Uint8*>(buffer);
+
+        if(scheme == Base64)
+        {
+            return prv::EncodingKernels::fromBase64(text.getData(), text.getSize(), bytes);
+        }
+
+        return prv::EncodingKernels::fromHex(text.getData(), text.getSize(), bytes);
+    }
+
+    /*! \brief Encode bytes into a String
+     *
+     * \param data   The bytes to encode
+     * \param size   The number of bytes
+     * \param scheme The Scheme to encode with
+     *
+     * \return Return the encoded String
+     *
+     */
+    String Encoding::encodeString(const void* data, std::size_t size, Scheme scheme)
+    {
+        String string = String::createUninitialized(getEncodedSize(size, scheme));
+
+        encode(data, size, string.getData(), scheme);
+
+        return string;
+    }
+
+    /*! \brief Decode characters into a String
+     *
+     * \param text   The characters to decode
+     * \param scheme The Scheme to decode with
+     *
+     * \return Return the decoded bytes, or the index of the first character which can not be decoded
+     *
+     */
+    ParseResult<String> Encoding::decodeString(const StringView& text, Scheme scheme)
+    {
+        String                   string = String::createUninitialized(getDecodedCapacity(text.getSize(), scheme));
+        ParseResult<std::size_t> result = decode(text, string.getData(), scheme);
+
+        if(!result.isValid())
+        {
+            return ParseResult<String>(String(), result.consumed, ParseResult<String>::InvalidCharacter);
+        }
+
+        /// Padding makes the String a bit larger than needed
+        string.setSizeInPlace(result.value);
+
+        return ParseResult<String>(std::move(string), result.consumed);
+    }
+}
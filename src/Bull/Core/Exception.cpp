@@ -1,5 +1,5 @@
 #include <Bull/Core/Exception.hpp>
-#include <Bull/Core/IO/StringStream.hpp>
+#include <Bull/Core/Format.hpp>
 
 namespace Bull
 {
@@ -21,15 +21,13 @@ namespace Bull
      */
     void Exception::log()
     {
-        StringStream entry;
-
-        entry << "Uncaught exception: " << "\n";
-        entry << "\tType: "             << getName()                   << "\n";
-        entry << "\tFile: "             << m_file                      << "\n";
-        entry << "\tFunction: "         << m_function                  << "\n";
-        entry << "\tLine: "             << String::number(m_line)      << "\n";
-        entry << "\tDate: "             << String::number(m_when.year) << "/" << String::number(m_when.month)  << "/" << String::number(m_when.day)                << "\n";
-        entry << "\tAt: "               << String::number(m_when.hour) << ":" << String::number(m_when.minute) << ":" << String::number(m_when.second.asSeconds()) << "\n";
+        String entry = BULL_FORMAT("Uncaught exception: \n"
+                                   "\tType: {}\n"
+                                   "\tFile: {}\n"
+                                   "\tFunction: {}\n"
+                                   "\tLine: {}\n"
+                                   "\tDate: {}\n",
+                                   getName(), m_file, m_function, m_line, m_when);
 
         Log::get()->log(entry, m_level);
     }
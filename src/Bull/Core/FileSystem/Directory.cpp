@@ -1,8 +1,8 @@
 #include <cstdio>
 
 #include <Bull/Core/FileSystem/Directory.hpp>
+#include <Bull/Core/FileSystem/DirectoryCopier.hpp>
 #include <Bull/Core/FileSystem/DirectoryImpl.hpp>
-#include <Bull/Core/FileSystem/File.hpp>
 
 namespace Bull
 {
@@ -40,35 +40,27 @@ namespace Bull
      */
     bool Directory::copy(const String& path, const String& newPath)
     {
-        Directory target(path);
-        bool success = true;
-
-        if(!Directory::exists(newPath))
-        {
-            Directory::create(newPath);
-        }
-
-        if(!target.isOpen())
-        {
-            return false;
-        }
+        return copy(path, newPath, DefaultCopyThreadCount).errors.empty();
+    }
 
-        for(const FileSystemEntity& ent : target.getContent())
-        {
-            if(ent.name != "." && ent.name != "..")
-            {
-                if(ent.isDirectory)
-                {
-                    success &= Directory::copy(path + "/" + ent.name, newPath + "/" + ent.name);
-                }
-                else
-                {
-                    success &= File::copy(path + "/" + ent.name, newPath + "/" + ent.name);
-                }
-            }
-        }
+    /*! \brief Copy a directory with several threads
+     *
+     * The calling thread walks through the directory while the others copy the files it finds.
+     * Symbolic links are neither followed nor copied, their paths are reported as errors
+     *
+     * \param path        The path (relative or absolute) of the directory to copy
+     * \param newPath     The new path (relative or absolute) of the directory
+     * \param threadCount The number of threads copying files
+     * \param listener    The listener to notify after each file, or nullptr
+     *
+     * \return Return the number of files and bytes copied, with the paths which could not be copied
+     *
+     */
+    DirectoryCopyReport Directory::copy(const String& path, const String& newPath, unsigned int threadCount, DirectoryCopyListener* listener)
+    {
+        prv::DirectoryCopier copier(threadCount, listener);
 
-        return success;
+        return copier.run(path, newPath);
     }
 
     /*! \brief Rename a directory
@@ -206,7 +198,7 @@ namespace Bull
     {
         if(m_impl)
         {
-            m_impl->getSystemHandler();
+            return m_impl->getSystemHandler();
         }
 
         return 0;
@@ -0,0 +1,211 @@
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <Bull/Core/FileSystem/Directory.hpp>
+#include <Bull/Core/FileSystem/DirectoryCopier.hpp>
+#include <Bull/Core/FileSystem/DirectoryImpl.hpp>
+#include <Bull/Core/FileSystem/File.hpp>
+#include <Bull/Core/Thread/Lock.hpp>
+#include <Bull/Core/Thread/Thread.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        /*! \brief Constructor
+         *
+         * \param threadCount The number of threads copying files
+         * \param listener    The listener to notify after each file, or nullptr
+         *
+         */
+        DirectoryCopier::DirectoryCopier(unsigned int threadCount, DirectoryCopyListener* listener) :
+            m_threadCount(threadCount > 0 ? threadCount : 1),
+            m_listener(listener),
+            m_isTraversalOver(false),
+            m_report({0, 0, std::vector<String>()})
+        {
+            /// Nothing
+        }
+
+        /*! \brief Copy a directory and its content
+         *
+         * \param path    The path of the directory to copy
+         * \param newPath The new path of the directory
+         *
+         * \return Return the number of files and bytes copied, with the paths which could not be copied
+         *
+         */
+        DirectoryCopyReport DirectoryCopier::run(const String& path, const String& newPath)
+        {
+            std::vector<std::unique_ptr<Thread>> threads;
+
+            for(unsigned int i = 0; i < m_threadCount; i++)
+            {
+                threads.emplace_back(new Thread(*this, &DirectoryCopier::work));
+                threads.back()->start();
+            }
+
+            /// The calling thread walks through the tree while the others copy what it finds
+            traverse(path, newPath);
+
+            {
+                Lock lock(m_mutex);
+
+                m_isTraversalOver = true;
+                m_jobQueued.signalAll();
+            }
+
+            for(std::unique_ptr<Thread>& thread : threads)
+            {
+                thread->wait();
+            }
+
+            return std::move(m_report);
+        }
+
+        /*! \brief Walk through a directory tree, create the directories and queue the files to copy
+         *
+         * Links are neither followed nor copied, they are reported as errors. A directory reached
+         * twice, through a mount point for instance, is reported as an error and walked through once
+         *
+         * \param path    The path of the directory to copy
+         * \param newPath The new path of the directory
+         *
+         */
+        void DirectoryCopier::traverse(const String& path, const String& newPath)
+        {
+            std::vector<std::pair<String, String>> pending;
+            std::set<std::pair<Uint64, Uint64>>    visited;
+
+            pending.emplace_back(path, newPath);
+
+            while(!pending.empty())
+            {
+                std::pair<String, String> directories = std::move(pending.back());
+                pending.pop_back();
+
+                std::unique_ptr<DirectoryImpl> source(DirectoryImpl::createInstance(directories.first));
+                std::pair<Uint64, Uint64>      identity;
+
+                if(!source || (source->getIdentity(identity.first, identity.second) && !visited.insert(identity).second))
+                {
+                    report(directories.first, 0, false);
+                    continue;
+                }
+
+                if(!Directory::exists(directories.second) && !Directory::create(directories.second))
+                {
+                    report(directories.first, 0, false);
+                    continue;
+                }
+
+                /// The sizes are needed for the report
+                for(const FileSystemEntity& entity : source->getContent(Directory::All | Directory::Details))
+                {
+                    if(entity.name == "." || entity.name == "..")
+                    {
+                        continue;
+                    }
+
+                    String entityPath    = String::concat(directories.first, "/", entity.name);
+                    String entityNewPath = String::concat(directories.second, "/", entity.name);
+
+                    if(entity.isLink)
+                    {
+                        report(entityPath, 0, false);
+                    }
+                    else if(entity.isDirectory)
+                    {
+                        pending.emplace_back(std::move(entityPath), std::move(entityNewPath));
+                    }
+                    else
+                    {
+                        push(Job{std::move(entityPath), std::move(entityNewPath), entity.size});
+                    }
+                }
+            }
+        }
+
+        /*! \brief Queue a file to copy, wait while the queue is full
+         *
+         * \param job The file to copy
+         *
+         */
+        void DirectoryCopier::push(Job&& job)
+        {
+            Lock lock(m_mutex);
+
+            while(m_jobs.size() >= QueueCapacity)
+            {
+                m_jobTaken.wait(m_mutex);
+            }
+
+            m_jobs.push_back(std::move(job));
+            m_jobQueued.signalOne();
+        }
+
+        /*! \brief Copy queued files until the traversal is over and the queue is empty
+         *
+         */
+        void DirectoryCopier::work()
+        {
+            while(true)
+            {
+                Job job;
+
+                {
+                    Lock lock(m_mutex);
+
+                    while(m_jobs.empty() && !m_isTraversalOver)
+                    {
+                        m_jobQueued.wait(m_mutex);
+                    }
+
+                    if(m_jobs.empty())
+                    {
+                        return;
+                    }
+
+                    job = std::move(m_jobs.front());
+                    m_jobs.pop_front();
+                    m_jobTaken.signalOne();
+                }
+
+                bool success = File::copy(job.path, job.newPath);
+
+                report(job.path, success ? job.size : 0, success);
+            }
+        }
+
+        /*! \brief Count a file in the report and notify the listener
+         *
+         * The queue is not locked meanwhile, so a slow listener does not hold back the walk nor the copies of other threads
+         *
+         * \param path    The path of the file or directory
+         * \param size    The number of bytes copied
+         * \param success True if the file was copied, false otherwise
+         *
+         */
+        void DirectoryCopier::report(const String& path, Uint64 size, bool success)
+        {
+            Lock lock(m_reportMutex);
+
+            if(success)
+            {
+                m_report.copiedSize  += size;
+                m_report.copiedFiles += 1;
+            }
+            else
+            {
+                m_report.errors.push_back(path);
+            }
+
+            if(m_listener)
+            {
+                m_listener->onProgress(path, success, m_report);
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+#ifndef Bull_DirectoryCopier_hpp
+#define Bull_DirectoryCopier_hpp
+
+#include <cstddef>
+#include <deque>
+
+#include <Bull/Core/FileSystem/DirectoryCopyListener.hpp>
+#include <Bull/Core/FileSystem/DirectoryCopyReport.hpp>
+#include <Bull/Core/Pattern/NonCopyable.hpp>
+#include <Bull/Core/Thread/ConditionVariable.hpp>
+#include <Bull/Core/Thread/Mutex.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        class DirectoryCopier : public NonCopyable
+        {
+        public:
+
+            static constexpr std::size_t QueueCapacity = 256;
+
+        public:
+
+            /*! \brief Constructor
+             *
+             * \param threadCount The number of threads copying files
+             * \param listener    The listener to notify after each file, or nullptr
+             *
+             */
+            DirectoryCopier(unsigned int threadCount, DirectoryCopyListener* listener);
+
+            /*! \brief Copy a directory and its content
+             *
+             * \param path    The path of the directory to copy
+             * \param newPath The new path of the directory
+             *
+             * \return Return the number of files and bytes copied, with the paths which could not be copied
+             *
+             */
+            DirectoryCopyReport run(const String& path, const String& newPath);
+
+        private:
+
+            struct Job
+            {
+                String path;
+                String newPath;
+                Uint64 size;
+            };
+
+            /*! \brief Walk through a directory tree, create the directories and queue the files to copy
+             *
+             * Links are neither followed nor copied, they are reported as errors. A directory reached
+             * twice, through a mount point for instance, is reported as an error and walked through once
+             *
+             * \param path    The path of the directory to copy
+             * \param newPath The new path of the directory
+             *
+             */
+            void traverse(const String& path, const String& newPath);
+
+            /*! \brief Queue a file to copy, wait while the queue is full
+             *
+             * \param job The file to copy
+             *
+             */
+            void push(Job&& job);
+
+            /*! \brief Copy queued files until the traversal is over and the queue is empty
+             *
+             */
+            void work();
+
+            /*! \brief Count a file in the report and notify the listener
+             *
+             * The queue is not locked meanwhile, so a slow listener does not hold back the walk nor the copies of other threads
+             *
+             * \param path    The path of the file or directory
+             * \param size    The number of bytes copied
+             * \param success True if the file was copied, false otherwise
+             *
+             */
+            void report(const String& path, Uint64 size, bool success);
+
+            unsigned int           m_threadCount;
+            DirectoryCopyListener* m_listener;
+            std::deque<Job>        m_jobs;
+            bool                   m_isTraversalOver;
+            Mutex                  m_mutex;
+            ConditionVariable      m_jobQueued;
+            ConditionVariable      m_jobTaken;
+            Mutex                  m_reportMutex;
+            DirectoryCopyReport    m_report;
+        };
+    }
+}
+
+#endif // Bull_DirectoryCopier_hpp
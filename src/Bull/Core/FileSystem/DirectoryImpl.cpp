@@ -65,7 +65,7 @@ namespace Bull
          */
         bool DirectoryImpl::remove(const String& name)
         {
-            return DirectoryImpl::remove(name);
+            return DirectoryImplType::remove(name);
         }
 
         /*! \brief Destructor
@@ -82,6 +82,16 @@ namespace Bull
              */
             virtual DirectoryHandler getSystemHandler() const = 0;
 
+            /*! \brief Get what identifies the directory on the system, whatever the path used to open it
+             *
+             * \param device The device holding the directory
+             * \param index  The index of the directory on its device
+             *
+             * \return Return true if the identity was read successfully, false otherwise
+             *
+             */
+            virtual bool getIdentity(Uint64& device, Uint64& index) const = 0;
+
         protected:
 
             /*! \brief Default constructor
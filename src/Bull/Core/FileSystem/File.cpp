@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 
@@ -7,6 +8,34 @@
 
 namespace Bull
 {
+    namespace
+    {
+        /*! \brief Append bytes of the read buffer to a line
+         *
+         * \param line The line to append to
+         * \param data The bytes to append
+         * \param size The number of bytes
+         *
+         */
+        void appendToLine(String& line, const Uint8* data, std::size_t size)
+        {
+            if(size == 0)
+            {
+                return;
+            }
+
+            /// Most lines fit in the buffer and are built with a single allocation
+            if(line.isEmpty())
+            {
+                line = String(reinterpret_cast<const char*>(data), size);
+            }
+            else
+            {
+                line += String(reinterpret_cast<const char*>(data), size);
+            }
+        }
+    }
+
     /*! \brief Create a file
     *
     * \param name The name of the file to create
@@ -80,7 +109,16 @@ namespace Bull
     File::File() :
         m_mode(OpeningMode::None),
         m_impl(nullptr),
-        m_eof(false)
+        m_eof(false),
+        m_readBufferSize(DefaultReadBufferSize),
+        m_readBegin(0),
+        m_readEnd(0),
+        m_writeBufferSize(0),
+        m_writePending(0),
+        m_flushInterval(Time::Zero),
+        m_writeCount(0),
+        m_systemWriteCount(0),
+        m_writtenSize(0)
     {
         /// Nothing
     }
@@ -93,7 +131,16 @@ namespace Bull
      */
     File::File(const String& name, Uint32 mode) :
         m_impl(nullptr),
-        m_eof(false)
+        m_eof(false),
+        m_readBufferSize(DefaultReadBufferSize),
+        m_readBegin(0),
+        m_readEnd(0),
+        m_writeBufferSize(0),
+        m_writePending(0),
+        m_flushInterval(Time::Zero),
+        m_writeCount(0),
+        m_systemWriteCount(0),
+        m_writtenSize(0)
     {
         open(name, mode);
     }
@@ -125,8 +172,12 @@ namespace Bull
             close();
         }
 
-        m_name = name;
-        m_mode = mode;
+        m_name             = name;
+        m_mode             = mode;
+        m_eof              = false;
+        m_writeCount       = 0;
+        m_systemWriteCount = 0;
+        m_writtenSize      = 0;
         m_impl.reset(prv::FileImpl::createInstance(m_name, m_mode));
 
         if(m_impl && mode & (OpeningMode::Read))
@@ -156,8 +207,15 @@ namespace Bull
     {
         Lock lock(m_mutex);
 
+        flush();
+
         m_impl.reset(nullptr);
         m_name = "";
+        m_readBuffer.reset();
+        m_readBegin = 0;
+        m_readEnd   = 0;
+        m_writeBuffer.reset();
+        m_writePending = 0;
     }
 
     /*! \brief Read bytes from the file
@@ -174,8 +232,33 @@ namespace Bull
 
         if(m_impl)
         {
-            std::memset(data, 0, size);
-            Uint64 read = m_impl->read(data, size);
+            flush();
+
+            Uint8* bytes = static_cast<Uint8*>(data);
+            Uint64 read  = std::min<Uint64>(size, m_readEnd - m_readBegin);
+
+            if(read > 0)
+            {
+                std::memcpy(bytes, m_readBuffer.get() + m_readBegin, read);
+                m_readBegin += read;
+            }
+
+            if(read < size)
+            {
+                /// Large reads do not need to go through the buffer
+                if(size - read >= m_readBufferSize)
+                {
+                    read += m_impl->read(bytes + read, size - read);
+                }
+                else if(fillReadBuffer() > 0)
+                {
+                    Uint64 buffered = std::min<Uint64>(size - read, m_readEnd - m_readBegin);
+
+                    std::memcpy(bytes + read, m_readBuffer.get() + m_readBegin, buffered);
+                    m_readBegin += buffered;
+                    read        += buffered;
+                }
+            }
 
             if(read < size)
             {
@@ -190,7 +273,7 @@ namespace Bull
 
     /*! \brief Read a line in the file
      *
-     * \param line The line to fill
+     * \param line The line to fill, without its line break
      *
      * \return Return true if the file has still lines to read
      *
@@ -201,37 +284,86 @@ namespace Bull
 
         if(m_impl && !m_eof)
         {
-            Uint8 byte;
+            flush();
 
             line.clear();
 
-            do
+            while(true)
             {
-                if(read(&byte, 1) == 1)
+                const Uint8* begin    = m_readBuffer.get() + m_readBegin;
+                std::size_t  buffered = m_readEnd - m_readBegin;
+                const void*  newline  = buffered > 0 ? std::memchr(begin, '\n', buffered) : nullptr;
+
+                if(newline)
                 {
-                    if(byte != '\n')
-                    {
-                        line += static_cast<char>(byte);
-                    }
+                    std::size_t length = static_cast<const Uint8*>(newline) - begin;
+
+                    appendToLine(line, begin, length);
+                    m_readBegin += length + 1;
+
+                    return true;
                 }
-                else
+
+                /// The line is longer than the buffer, keep what we have and start over
+                if(buffered == m_readBufferSize)
                 {
-                    m_eof = true;
+                    appendToLine(line, begin, buffered);
+                    m_readBegin = 0;
+                    m_readEnd   = 0;
                 }
-            }while(!m_eof && byte != '\n');
 
-            return true;
+                if(fillReadBuffer() == 0)
+                {
+                    appendToLine(line, m_readBuffer.get() + m_readBegin, m_readEnd - m_readBegin);
+                    m_readBegin = 0;
+                    m_readEnd   = 0;
+                    m_eof       = true;
+
+                    return true;
+                }
+            }
         }
 
         return false;
     }
 
+    /*! \brief Set the size of the buffer used to read ahead in the file
+     *
+     * Bytes read ahead but not consumed yet are given back to the file
+     *
+     * \param size The size of the buffer, a size of 1 disables reading ahead
+     *
+     */
+    void File::setReadBufferSize(std::size_t size)
+    {
+        Lock lock(m_mutex);
+
+        discardReadBuffer();
+
+        m_readBuffer.reset();
+        m_readBufferSize = std::max<std::size_t>(size, 1);
+    }
+
+    /*! \brief Get the size of the buffer used to read ahead in the file
+     *
+     * \return Return the size of the buffer
+     *
+     */
+    std::size_t File::getReadBufferSize() const
+    {
+        Lock lock(m_mutex);
+
+        return m_readBufferSize;
+    }
+
     /*! \brief Write a buffer in the file
+     *
+     * When a write buffer is set, small writes are kept in it until the next flush
      *
      * \param data The buffer to write into the file
      * \param size The size of the buffer
      *
-     * \return Return the number of bytes actually written
+     * \return Return the number of bytes actually written or kept in the write buffer
      *
      */
     Uint64 File::write(const void* data, Uint64 size)
@@ -240,7 +372,40 @@ namespace Bull
 
         if(m_impl)
         {
-            return m_impl->write(data, size);
+            discardReadBuffer();
+
+            m_writeCount += 1;
+
+            if(m_writePending + size > m_writeBufferSize && !flush())
+            {
+                return 0;
+            }
+
+            /// Writes which would fill the buffer on their own do not need to be copied
+            if(size >= m_writeBufferSize)
+            {
+                return writeToFile(data, size);
+            }
+
+            if(!m_writeBuffer)
+            {
+                m_writeBuffer.reset(new Uint8[m_writeBufferSize]);
+            }
+
+            if(m_writePending == 0)
+            {
+                m_flushClock.restart();
+            }
+
+            std::memcpy(m_writeBuffer.get() + m_writePending, data, size);
+            m_writePending += size;
+
+            if(m_flushInterval > Time::Zero && m_flushClock.getElapsedTime() >= m_flushInterval)
+            {
+                flush();
+            }
+
+            return size;
         }
 
         return 0;
@@ -260,6 +425,122 @@ namespace Bull
         return write(&string[0], string.getSize());
     }
 
+    /*! \brief Write the bytes kept in the write buffer into the file
+     *
+     * \return Return true if every byte was written, false otherwise
+     *
+     */
+    bool File::flush()
+    {
+        Lock lock(m_mutex);
+
+        if(m_impl && m_writePending > 0)
+        {
+            std::size_t written = writeToFile(m_writeBuffer.get(), m_writePending);
+
+            /// Keep what the system refused so that a next flush can try again
+            std::memmove(m_writeBuffer.get(), m_writeBuffer.get() + written, m_writePending - written);
+            m_writePending -= written;
+        }
+
+        return m_writePending == 0;
+    }
+
+    /*! \brief Set the size of the buffer used to gather small writes
+     *
+     * The write buffer is flushed when it is full, when flush or close is called,
+     * when the file is read or seeked, and after the flush interval
+     *
+     * \param size The size of the buffer, a size of 0 disables write buffering
+     *
+     */
+    void File::setWriteBufferSize(std::size_t size)
+    {
+        Lock lock(m_mutex);
+
+        flush();
+
+        if(m_writePending == 0)
+        {
+            m_writeBuffer.reset();
+            m_writeBufferSize = size;
+        }
+    }
+
+    /*! \brief Get the size of the buffer used to gather small writes
+     *
+     * \return Return the size of the buffer
+     *
+     */
+    std::size_t File::getWriteBufferSize() const
+    {
+        Lock lock(m_mutex);
+
+        return m_writeBufferSize;
+    }
+
+    /*! \brief Set the longest time bytes can stay in the write buffer
+     *
+     * The interval is checked when writing, there is no background flush
+     *
+     * \param interval The interval, Time::Zero to flush only when the buffer is full
+     *
+     */
+    void File::setFlushInterval(const Time& interval)
+    {
+        Lock lock(m_mutex);
+
+        m_flushInterval = interval;
+    }
+
+    /*! \brief Get the longest time bytes can stay in the write buffer
+     *
+     * \return Return the interval
+     *
+     */
+    Time File::getFlushInterval() const
+    {
+        Lock lock(m_mutex);
+
+        return m_flushInterval;
+    }
+
+    /*! \brief Get the number of calls to write since the file was opened
+     *
+     * \return Return the number of calls
+     *
+     */
+    Uint64 File::getWriteCount() const
+    {
+        Lock lock(m_mutex);
+
+        return m_writeCount;
+    }
+
+    /*! \brief Get the number of writes made to the operating system since the file was opened
+     *
+     * \return Return the number of system calls
+     *
+     */
+    Uint64 File::getSystemWriteCount() const
+    {
+        Lock lock(m_mutex);
+
+        return m_systemWriteCount;
+    }
+
+    /*! \brief Get the number of bytes written to the operating system since the file was opened
+     *
+     * \return Return the number of bytes
+     *
+     */
+    Uint64 File::getWrittenSize() const
+    {
+        Lock lock(m_mutex);
+
+        return m_writtenSize;
+    }
+
 
     /*! \brief Get the date of the creation of the file
      *
@@ -323,7 +604,7 @@ namespace Bull
 
         if(m_impl)
         {
-            return m_impl->getCursor();
+            return m_impl->getCursor() - (m_readEnd - m_readBegin) + m_writePending;
         }
 
         return 0;
@@ -342,6 +623,15 @@ namespace Bull
 
         if(m_impl)
         {
+            flush();
+
+            /// The cursor of the file is ahead of ours by the bytes read ahead
+            offset -= static_cast<Int64>(m_readEnd - m_readBegin);
+
+            m_readBegin = 0;
+            m_readEnd   = 0;
+            m_eof       = false;
+
             return m_impl->moveCursor(offset);
         }
 
@@ -361,6 +651,12 @@ namespace Bull
 
         if(m_impl)
         {
+            flush();
+
+            m_readBegin = 0;
+            m_readEnd   = 0;
+            m_eof       = false;
+
             return m_impl->setCursor(offset);
         }
 
@@ -390,7 +686,8 @@ namespace Bull
 
         if(m_impl)
         {
-            return m_impl->getSize();
+            /// Bytes in the write buffer may extend the file
+            return std::max(m_impl->getSize(), m_impl->getCursor() + m_writePending);
         }
 
         return 0;
@@ -452,4 +749,76 @@ namespace Bull
 
         return 0;
     }
+
+    /*! \brief Fill the free space of the read buffer with the next bytes of the file
+     *
+     * \return Return the number of bytes added to the read buffer
+     *
+     */
+    std::size_t File::fillReadBuffer()
+    {
+        if(!m_readBuffer)
+        {
+            m_readBuffer.reset(new Uint8[m_readBufferSize]);
+        }
+
+        if(m_readBegin > 0)
+        {
+            std::memmove(m_readBuffer.get(), m_readBuffer.get() + m_readBegin, m_readEnd - m_readBegin);
+            m_readEnd  -= m_readBegin;
+            m_readBegin = 0;
+        }
+
+        std::size_t read = m_impl->read(m_readBuffer.get() + m_readEnd, m_readBufferSize - m_readEnd);
+
+        m_readEnd += read;
+
+        return read;
+    }
+
+    /*! \brief Move the cursor of the file back before the bytes read ahead and drop them
+     *
+     */
+    void File::discardReadBuffer()
+    {
+        if(m_impl && m_readBegin < m_readEnd)
+        {
+            m_impl->moveCursor(-static_cast<Int64>(m_readEnd - m_readBegin));
+        }
+
+        m_readBegin = 0;
+        m_readEnd   = 0;
+    }
+
+    /*! \brief Write bytes into the file, bypassing the write buffer
+     *
+     * \param data The bytes to write
+     * \param size The number of bytes
+     *
+     * \return Return the number of bytes written
+     *
+     */
+    Uint64 File::writeToFile(const void* data, Uint64 size)
+    {
+        const Uint8* bytes   = static_cast<const Uint8*>(data);
+        Uint64       written = 0;
+
+        while(written < size)
+        {
+            Uint64 chunk = m_impl->write(bytes + written, size - written);
+
+            m_systemWriteCount += 1;
+
+            if(chunk == 0)
+            {
+                break;
+            }
+
+            written += chunk;
+        }
+
+        m_writtenSize += written;
+
+        return written;
+    }
 }
@@ -0,0 +1,321 @@
+#include <algorithm>
+#include <cstring>
+
+#include <Bull/Core/FileSystem/MappedFile.hpp>
+#include <Bull/Core/FileSystem/MappedFileImpl.hpp>
+
+namespace Bull
+{
+    /*! \brief Constructor
+     *
+     */
+    MappedFile::MappedFile() :
+        m_access(ReadOnly),
+        m_advice(Normal),
+        m_impl(nullptr),
+        m_offset(0),
+        m_size(0),
+        m_cursor(0)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param name   The name of the file to map
+     * \param access The Access to the mapped bytes
+     * \param offset The offset in the file of the first byte to map
+     * \param size   The number of bytes to map, 0 to map up to the end of the file
+     *
+     */
+    MappedFile::MappedFile(const String& name, Access access, Uint64 offset, Uint64 size) :
+        MappedFile()
+    {
+        open(name, access, offset, size);
+    }
+
+    /*! \brief Destructor
+     *
+     */
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    /*! \brief Open and map a file
+     *
+     * \param name   The name of the file to map
+     * \param access The Access to the mapped bytes
+     * \param offset The offset in the file of the first byte to map
+     * \param size   The number of bytes to map, 0 to map up to the end of the file
+     *
+     * \return Return true if the file was mapped successfully, false otherwise
+     *
+     */
+    bool MappedFile::open(const String& name, Access access, Uint64 offset, Uint64 size)
+    {
+        close();
+
+        m_impl.reset(prv::MappedFileImpl::createInstance(name, access));
+
+        if(m_impl)
+        {
+            m_name   = name;
+            m_access = access;
+
+            if(map(offset, size))
+            {
+                return true;
+            }
+
+            close();
+        }
+
+        return false;
+    }
+
+    /*! \brief Check if a file is open
+     *
+     * \return Return true if the file is open, false otherwise
+     *
+     */
+    bool MappedFile::isOpen() const
+    {
+        return m_impl.get() != nullptr;
+    }
+
+    /*! \brief Unmap and close the file
+     *
+     */
+    void MappedFile::close()
+    {
+        m_impl.reset(nullptr);
+        m_name   = "";
+        m_advice = Normal;
+        m_offset = 0;
+        m_size   = 0;
+        m_cursor = 0;
+    }
+
+    /*! \brief Map another window of the open file
+     *
+     * The previous window is unmapped and the cursor goes back to the start of the new one,
+     * the last Advice given with advise is applied to the new window
+     *
+     * \param offset The offset in the file of the first byte to map
+     * \param size   The number of bytes to map, 0 to map up to the end of the file
+     *
+     * \return Return true if the window was mapped successfully, false otherwise
+     *
+     */
+    bool MappedFile::map(Uint64 offset, Uint64 size)
+    {
+        if(!m_impl)
+        {
+            return false;
+        }
+
+        Uint64 fileSize = m_impl->getFileSize();
+
+        if(offset > fileSize)
+        {
+            return false;
+        }
+
+        if(size == 0 || size > fileSize - offset)
+        {
+            size = fileSize - offset;
+        }
+
+        m_offset = 0;
+        m_size   = 0;
+        m_cursor = 0;
+
+        if(!m_impl->map(offset, size))
+        {
+            return false;
+        }
+
+        m_offset = offset;
+        m_size   = size;
+
+        /// The advice is only a hint, the window is usable even if the system does not take it
+        if(m_advice != Normal && m_size > 0)
+        {
+            m_impl->advise(m_advice);
+        }
+
+        return true;
+    }
+
+    /*! \brief Tell the system how the mapped bytes will be accessed
+     *
+     * The advice is kept and given again for every window mapped later
+     *
+     * \param advice The Advice to give
+     *
+     * \return Return true if the system took the advice or if no window is mapped yet, false otherwise
+     *
+     */
+    bool MappedFile::advise(Advice advice)
+    {
+        if(!m_impl)
+        {
+            return false;
+        }
+
+        m_advice = advice;
+
+        if(m_size == 0)
+        {
+            return true;
+        }
+
+        return m_impl->advise(advice);
+    }
+
+    /*! \brief Write the changes made to the mapped bytes back into the file
+     *
+     * \return Return true if the changes were written successfully, false otherwise
+     *
+     */
+    bool MappedFile::flush()
+    {
+        if(m_impl)
+        {
+            return m_impl->flush();
+        }
+
+        return false;
+    }
+
+    /*! \brief Copy mapped bytes starting at the cursor
+     *
+     * \param data A pointer to the memory area to fill
+     * \param size The size of the memory area to fill
+     *
+     * \return Return the number of read bytes
+     *
+     */
+    Uint64 MappedFile::read(void* data, Uint64 size)
+    {
+        Uint64 read = std::min(size, m_size - m_cursor);
+
+        if(read > 0)
+        {
+            std::memcpy(data, m_impl->getData() + m_cursor, read);
+            m_cursor += read;
+        }
+
+        return read;
+    }
+
+    /*! \brief Set the reading position in the window
+     *
+     * \param position The position to seek to
+     *
+     * \return Return the actual position, the size of the window at most
+     *
+     */
+    Uint64 MappedFile::setCursor(Uint64 position)
+    {
+        m_cursor = std::min(position, m_size);
+
+        return m_cursor;
+    }
+
+    /*! \brief Get the reading position in the window
+     *
+     * \return Return the current position
+     *
+     */
+    Uint64 MappedFile::getCursor() const
+    {
+        return m_cursor;
+    }
+
+    /*! \brief Get the size of the window
+     *
+     * \return Return the number of mapped bytes
+     *
+     */
+    Uint64 MappedFile::getSize() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Get the offset of the window in the file
+     *
+     * \return Return the offset of the first mapped byte
+     *
+     */
+    Uint64 MappedFile::getOffset() const
+    {
+        return m_offset;
+    }
+
+    /*! \brief Get the size of the file
+     *
+     * \return Return the size of the file
+     *
+     */
+    Uint64 MappedFile::getFileSize() const
+    {
+        if(m_impl)
+        {
+            return m_impl->getFileSize();
+        }
+
+        return 0;
+    }
+
+    /*! \brief Get the name of the file
+     *
+     * \return Return the name of the file
+     *
+     */
+    String MappedFile::getName() const
+    {
+        return m_name;
+    }
+
+    /*! \brief Get the Access to the mapped bytes
+     *
+     * \return Return the Access
+     *
+     */
+    MappedFile::Access MappedFile::getAccess() const
+    {
+        return m_access;
+    }
+
+    /*! \brief Get the mapped bytes
+     *
+     * \return Return the first byte of the window, nullptr if nothing is mapped
+     *
+     */
+    const Uint8* MappedFile::getData() const
+    {
+        if(m_impl)
+        {
+            return m_impl->getData();
+        }
+
+        return nullptr;
+    }
+
+    /*! \brief Get the mapped bytes to modify them
+     *
+     * \return Return the first byte of the window, nullptr if nothing is mapped or if the file is mapped as ReadOnly
+     *
+     */
+    Uint8* MappedFile::getWritableData()
+    {
+        if(m_impl && m_access == ReadWrite)
+        {
+            return m_impl->getData();
+        }
+
+        return nullptr;
+    }
+}
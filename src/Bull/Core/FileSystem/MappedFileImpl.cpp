@@ -0,0 +1,45 @@
+#include <Bull/Core/FileSystem/MappedFileImpl.hpp>
+#include <Bull/Core/System/Config.hpp>
+
+#if defined BULL_OS_WINDOWS
+    #include <Bull/Core/FileSystem/Win32/MappedFileImplWin32.hpp>
+    typedef Bull::prv::MappedFileImplWin32 MappedFileImplType;
+#else
+    #include <Bull/Core/FileSystem/Unix/MappedFileImplUnix.hpp>
+    typedef Bull::prv::MappedFileImplUnix MappedFileImplType;
+#endif // defined
+
+namespace Bull
+{
+    namespace prv
+    {
+        /*! \brief Create a OS specific MappedFileImpl
+         *
+         * \param name   The name of the file to open
+         * \param access The Access to the mapped bytes
+         *
+         * \return Return the instance of the MappedFileImpl if the file could be opened, nullptr otherwise
+         *
+         */
+        MappedFileImpl* MappedFileImpl::createInstance(const String& name, MappedFile::Access access)
+        {
+            MappedFileImplType* impl = new MappedFileImplType();
+
+            if(impl->open(name, access))
+            {
+                return impl;
+            }
+
+            delete impl;
+            return nullptr;
+        }
+
+        /*! \brief Destructor
+         *
+         */
+        MappedFileImpl::~MappedFileImpl()
+        {
+            /// Nothing
+        }
+    }
+}
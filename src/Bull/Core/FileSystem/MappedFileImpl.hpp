@@ -0,0 +1,90 @@
+#ifndef Bull_MappedFileImpl_hpp
+#define Bull_MappedFileImpl_hpp
+
+#include <Bull/Core/FileSystem/MappedFile.hpp>
+#include <Bull/Core/Pattern/NonCopyable.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        class MappedFileImpl : public NonCopyable
+        {
+        public:
+
+            /*! \brief Create a OS specific MappedFileImpl
+             *
+             * \param name   The name of the file to open
+             * \param access The Access to the mapped bytes
+             *
+             * \return Return the instance of the MappedFileImpl if the file could be opened, nullptr otherwise
+             *
+             */
+            static MappedFileImpl* createInstance(const String& name, MappedFile::Access access);
+
+        public:
+
+            /*! \brief Destructor
+             *
+             */
+            virtual ~MappedFileImpl();
+
+            /*! \brief Open a file
+             *
+             * \param name   The name of the file to open
+             * \param access The Access to the mapped bytes
+             *
+             * \return Return true if the file was opened successfully, false otherwise
+             *
+             */
+            virtual bool open(const String& name, MappedFile::Access access) = 0;
+
+            /*! \brief Map a window of the file, the previous window is unmapped
+             *
+             * \param offset The offset in the file of the first byte to map, it does not need to be aligned
+             * \param size   The number of bytes to map, the window must lie in the file
+             *
+             * \return Return true if the window was mapped successfully, false otherwise
+             *
+             */
+            virtual bool map(Uint64 offset, Uint64 size) = 0;
+
+            /*! \brief Unmap the current window
+             *
+             */
+            virtual void unmap() = 0;
+
+            /*! \brief Tell the system how the mapped bytes will be accessed
+             *
+             * \param advice The Advice to give
+             *
+             * \return Return true if the system took the advice, false otherwise or if nothing is mapped
+             *
+             */
+            virtual bool advise(MappedFile::Advice advice) = 0;
+
+            /*! \brief Write the changes made to the mapped bytes back into the file
+             *
+             * \return Return true if the changes were written successfully, false otherwise
+             *
+             */
+            virtual bool flush() = 0;
+
+            /*! \brief Get the first byte of the window
+             *
+             * \return Return the first byte of the window, nullptr if nothing is mapped
+             *
+             */
+            virtual Uint8* getData() const = 0;
+
+            /*! \brief Get the size of the file
+             *
+             * \return Return the size of the file
+             *
+             */
+            virtual Uint64 getFileSize() const = 0;
+        };
+    }
+}
+
+#endif // Bull_MappedFileImpl_hpp
@@ -1,22 +1,240 @@
+#include <fcntl.h>
+#include <memory>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utility>
+
 #include <Bull/Core/FileSystem/Unix/DirectoryImplUnix.hpp>
+#include <Bull/Core/System/Config.hpp>
+
+#if defined BULL_OS_GNU_LINUX
+    #include <sys/syscall.h>
+#endif
 
 namespace Bull
 {
     namespace prv
     {
+        /*! \brief Create a directory
+         *
+         * \param name The name of the directory to create
+         *
+         * \return Return true if the directory was created successfully, false otherwise
+         *
+         */
+        bool DirectoryImplUnix::create(const String& name)
+        {
+            return mkdir(name, S_IRWXU | S_IRWXG | S_IRWXO) == 0;
+        }
+
+        /*! \brief Check if a directory exists
+         *
+         * \param name The name of the directory to check
+         *
+         * \return Return true if the directory exists, false otherwise
+         *
+         */
+        bool DirectoryImplUnix::exists(const String& name)
+        {
+            struct stat64 info;
+
+            return stat64(name, &info) == 0 && S_ISDIR(info.st_mode);
+        }
+
+        /*! \brief Delete a directory
+         *
+         * \param name The name of the directory to delete
+         *
+         * \return Return true if the directory was deleted successfully, false otherwise
+         *
+         */
+        bool DirectoryImplUnix::remove(const String& name)
+        {
+            return rmdir(name) == 0;
+        }
+
+        /*! \brief Convert a timespec to a Bull::Date
+         *
+         * \param time The timespec to convert
+         *
+         * \return Return the equivalent Bull::Date in local time
+         *
+         */
+        Date DirectoryImplUnix::timeToDate(const struct timespec& time)
+        {
+            Date      date;
+            struct tm sysDate;
+
+            localtime_r(&time.tv_sec, &sysDate);
+
+            date.year      = 1900 + sysDate.tm_year;
+            date.month     = Date::Month(sysDate.tm_mon + 1);
+            date.day       = sysDate.tm_mday;
+            date.dayOfWeek = Date::Day(sysDate.tm_wday);
+            date.hour      = sysDate.tm_hour;
+            date.minute    = sysDate.tm_min;
+            date.second    = Time::seconds(sysDate.tm_sec) + Time::milliseconds(time.tv_nsec / 1000000);
+
+            return date;
+        }
+
+        /*! \brief Constructor
+         *
+         */
+        DirectoryImplUnix::DirectoryImplUnix() :
+            m_handler(nullptr)
+        {
+            /// Nothing
+        }
+
+        /*! \brief Destructor
+         *
+         */
+        DirectoryImplUnix::~DirectoryImplUnix()
+        {
+            if(m_handler)
+            {
+                closedir(m_handler);
+            }
+        }
+
+        /*! \brief Open a directory
+         *
+         * \param path The path of the directory to open
+         *
+         * \return Return true if the directory was opened successfully, false otherwise
+         *
+         */
         bool DirectoryImplUnix::open(const String& path)
         {
-            return false;
+            m_handler = opendir(path);
+
+            return m_handler != nullptr;
         }
 
+        /*! \brief Get the content of this Directory
+         *
+         * Entities are classified from their directory entry, their size and dates are only
+         * read with Directory::Details. Links are reported as links, never as their target
+         *
+         * \param flags What we have to look for
+         *
+         * \return Return the list of content entity
+         *
+         */
         std::vector<FileSystemEntity> DirectoryImplUnix::getContent(Uint32 flags)
         {
-            return std::vector<FileSystemEntity>();
+            std::vector<FileSystemEntity> content;
+
+            #if defined BULL_OS_GNU_LINUX && defined SYS_getdents64
+                int                     handler = dirfd(m_handler);
+                std::unique_ptr<char[]> buffer(new char[EntryBufferSize]);
+
+                /// Each call fills the buffer with as many entries as it can hold
+                lseek64(handler, 0, SEEK_SET);
+
+                while(true)
+                {
+                    long size = syscall(SYS_getdents64, handler, buffer.get(), EntryBufferSize);
+
+                    if(size <= 0)
+                    {
+                        break;
+                    }
+
+                    for(long offset = 0; offset < size;)
+                    {
+                        const struct dirent64* entry = reinterpret_cast<const struct dirent64*>(buffer.get() + offset);
+
+                        addEntity(content, entry->d_name, entry->d_type, flags);
+                        offset += entry->d_reclen;
+                    }
+                }
+            #else
+                rewinddir(m_handler);
+
+                while(const struct dirent* entry = readdir(m_handler))
+                {
+                    addEntity(content, entry->d_name, entry->d_type, flags);
+                }
+            #endif
+
+            return content;
         }
 
+        /*! \brief Get the directory system handler
+         *
+         * \return Return the native directory system handler
+         *
+         */
         DirectoryHandler DirectoryImplUnix::getSystemHandler() const
         {
-            return nullptr;
+            return m_handler;
+        }
+
+        /*! \brief Get what identifies the directory on the system, whatever the path used to open it
+         *
+         * \param device The device holding the directory
+         * \param index  The index of the directory on its device
+         *
+         * \return Return true if the identity was read successfully, false otherwise
+         *
+         */
+        bool DirectoryImplUnix::getIdentity(Uint64& device, Uint64& index) const
+        {
+            struct stat64 info;
+
+            if(fstat64(dirfd(m_handler), &info) == 0)
+            {
+                device = info.st_dev;
+                index  = info.st_ino;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        /*! \brief Add a directory entry to a content
+         *
+         * \param content The content to fill
+         * \param name    The name of the entry
+         * \param type    The d_type of the entry
+         * \param flags   What we have to look for
+         *
+         */
+        void DirectoryImplUnix::addEntity(std::vector<FileSystemEntity>& content, const char* name, unsigned char type, Uint32 flags) const
+        {
+            FileSystemEntity entity;
+            struct stat64    info;
+            bool             hasInfo = false;
+
+            /// Some file systems do not fill d_type. Links are never followed so they cannot make a tree loop
+            if(type == DT_UNKNOWN)
+            {
+                hasInfo = fstatat64(dirfd(m_handler), name, &info, AT_SYMLINK_NOFOLLOW) == 0;
+                type    = !hasInfo ? DT_UNKNOWN : S_ISDIR(info.st_mode) ? DT_DIR : S_ISREG(info.st_mode) ? DT_REG : S_ISLNK(info.st_mode) ? DT_LNK : DT_UNKNOWN;
+            }
+
+            entity.isDirectory = type == DT_DIR;
+            entity.isFile      = type == DT_REG;
+            entity.isLink      = type == DT_LNK;
+
+            if((flags & Directory::Directories && entity.isDirectory) || (flags & Directory::Files && entity.isFile) || (flags & Directory::Links && entity.isLink))
+            {
+                entity.name = name;
+                entity.size = 0;
+
+                if(flags & Directory::Details && (hasInfo || fstatat64(dirfd(m_handler), name, &info, AT_SYMLINK_NOFOLLOW) == 0))
+                {
+                    entity.size           = info.st_size;
+                    entity.lastAccessDate = timeToDate(info.st_atim);
+                    entity.lastWriteDate  = timeToDate(info.st_mtim);
+                }
+
+                content.push_back(std::move(entity));
+            }
         }
     }
 }
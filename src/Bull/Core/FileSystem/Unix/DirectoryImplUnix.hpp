@@ -1,6 +1,9 @@
 #ifndef Bull_DirectoryImplUnix_hpp
 #define Bull_DirectoryImplUnix_hpp
 
+#include <cstddef>
+#include <ctime>
+
 #include <Bull/Core/FileSystem/DirectoryImpl.hpp>
 
 namespace Bull
@@ -11,11 +14,109 @@ namespace Bull
         {
         public:
 
+            static constexpr std::size_t EntryBufferSize = 256 * 1024;
+
+            /*! \brief Create a directory
+             *
+             * \param name The name of the directory to create
+             *
+             * \return Return true if the directory was created successfully, false otherwise
+             *
+             */
+            static bool create(const String& name);
+
+            /*! \brief Check if a directory exists
+             *
+             * \param name The name of the directory to check
+             *
+             * \return Return true if the directory exists, false otherwise
+             *
+             */
+            static bool exists(const String& name);
+
+            /*! \brief Delete a directory
+             *
+             * \param name The name of the directory to delete
+             *
+             * \return Return true if the directory was deleted successfully, false otherwise
+             *
+             */
+            static bool remove(const String& name);
+
+        private:
+
+            /*! \brief Convert a timespec to a Bull::Date
+             *
+             * \param time The timespec to convert
+             *
+             * \return Return the equivalent Bull::Date in local time
+             *
+             */
+            static Date timeToDate(const struct timespec& time);
+
+        public:
+
+            /*! \brief Constructor
+             *
+             */
+            DirectoryImplUnix();
+
+            /*! \brief Destructor
+             *
+             */
+            ~DirectoryImplUnix();
+
+            /*! \brief Open a directory
+             *
+             * \param path The path of the directory to open
+             *
+             * \return Return true if the directory was opened successfully, false otherwise
+             *
+             */
             bool open(const String& path) override;
 
+            /*! \brief Get the content of this Directory
+             *
+             * Entities are classified from their directory entry, their size and dates are only
+             * read with Directory::Details. Links are reported as links, never as their target
+             *
+             * \param flags What we have to look for
+             *
+             * \return Return the list of content entity
+             *
+             */
             std::vector<FileSystemEntity> getContent(Uint32 flags) override;
 
+            /*! \brief Get the directory system handler
+             *
+             * \return Return the native directory system handler
+             *
+             */
             DirectoryHandler getSystemHandler() const override;
+
+            /*! \brief Get what identifies the directory on the system, whatever the path used to open it
+             *
+             * \param device The device holding the directory
+             * \param index  The index of the directory on its device
+             *
+             * \return Return true if the identity was read successfully, false otherwise
+             *
+             */
+            bool getIdentity(Uint64& device, Uint64& index) const override;
+
+        private:
+
+            /*! \brief Add a directory entry to a content
+             *
+             * \param content The content to fill
+             * \param name    The name of the entry
+             * \param type    The d_type of the entry
+             * \param flags   What we have to look for
+             *
+             */
+            void addEntity(std::vector<FileSystemEntity>& content, const char* name, unsigned char type, Uint32 flags) const;
+
+            DirectoryHandler m_handler;
         };
     }
 }
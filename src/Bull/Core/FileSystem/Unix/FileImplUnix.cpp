@@ -1,15 +1,192 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 #include <fcntl.h>
+#include <memory>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
 #include <Bull/Core/FileSystem/Unix/FileImplUnix.hpp>
 #include <Bull/Core/Log.hpp>
+#include <Bull/Core/System/Config.hpp>
+
+#if defined BULL_OS_GNU_LINUX
+    #include <linux/fs.h>
+    #include <sys/ioctl.h>
+    #include <sys/sendfile.h>
+    #include <sys/syscall.h>
+#endif
 
 namespace Bull
 {
     namespace prv
     {
+        namespace
+        {
+            constexpr std::size_t CopyChunkSize       = 1 << 30;
+            constexpr std::size_t CopyBufferSize      = 1 << 20;
+            constexpr std::size_t CopyBufferAlignment = 4096;
+
+            /*! \brief Share the extents of a file with another file, on file systems which support reflinks
+             *
+             * \param source      The file to copy
+             * \param destination The empty file to fill
+             *
+             * \return Return true if the whole file was cloned, false otherwise
+             *
+             */
+            bool cloneFile(int source, int destination)
+            {
+                #if defined BULL_OS_GNU_LINUX && defined FICLONE
+                    return ioctl(destination, FICLONE, source) == 0;
+                #else
+                    (void)source;
+                    (void)destination;
+
+                    return false;
+                #endif
+            }
+
+            /*! \brief Copy a file with copy_file_range, the kernel copies the bytes or offloads the copy to the file system
+             *
+             * \param source      The file to copy
+             * \param destination The file to fill
+             * \param copied      The number of bytes already copied, updated while copying
+             * \param size        The size of the file to copy
+             *
+             * \return Return true if the whole file was copied, false otherwise
+             *
+             */
+            bool copyFileRange(int source, int destination, Uint64& copied, Uint64 size)
+            {
+                #if defined BULL_OS_GNU_LINUX && defined SYS_copy_file_range
+                    while(copied < size)
+                    {
+                        loff_t  sourceOffset      = copied;
+                        loff_t  destinationOffset = copied;
+                        ssize_t chunk             = syscall(SYS_copy_file_range, source, &sourceOffset, destination, &destinationOffset,
+                                                            std::min<Uint64>(size - copied, CopyChunkSize), 0);
+
+                        if(chunk <= 0)
+                        {
+                            return false;
+                        }
+
+                        copied += chunk;
+                    }
+
+                    return true;
+                #else
+                    (void)source;
+                    (void)destination;
+                    (void)copied;
+                    (void)size;
+
+                    return false;
+                #endif
+            }
+
+            /*! \brief Copy a file with sendfile, the bytes stay in the kernel
+             *
+             * \param source      The file to copy
+             * \param destination The file to fill
+             * \param copied      The number of bytes already copied, updated while copying
+             * \param size        The size of the file to copy
+             *
+             * \return Return true if the whole file was copied, false otherwise
+             *
+             */
+            bool sendFile(int source, int destination, Uint64& copied, Uint64 size)
+            {
+                #if defined BULL_OS_GNU_LINUX
+                    /// sendfile writes at the cursor of the destination
+                    if(lseek64(destination, copied, SEEK_SET) == -1)
+                    {
+                        return false;
+                    }
+
+                    while(copied < size)
+                    {
+                        off64_t offset = copied;
+                        ssize_t chunk  = sendfile64(destination, source, &offset, std::min<Uint64>(size - copied, CopyChunkSize));
+
+                        if(chunk <= 0)
+                        {
+                            return false;
+                        }
+
+                        copied += chunk;
+                    }
+
+                    return true;
+                #else
+                    (void)source;
+                    (void)destination;
+                    (void)copied;
+                    (void)size;
+
+                    return false;
+                #endif
+            }
+
+            /*! \brief Copy a file through a large aligned buffer
+             *
+             * \param source      The file to copy
+             * \param destination The file to fill
+             * \param copied      The number of bytes already copied, updated while copying
+             * \param size        The size of the file to copy
+             *
+             * \return Return true if the whole file was copied, false otherwise
+             *
+             */
+            bool copyBuffered(int source, int destination, Uint64& copied, Uint64 size)
+            {
+                void* memory = nullptr;
+
+                if(posix_memalign(&memory, CopyBufferAlignment, CopyBufferSize) != 0)
+                {
+                    return false;
+                }
+
+                std::unique_ptr<char, decltype(&std::free)> buffer(static_cast<char*>(memory), &std::free);
+
+                while(copied < size)
+                {
+                    ssize_t chunk = pread64(source, buffer.get(), std::min<Uint64>(size - copied, CopyBufferSize), copied);
+
+                    if(chunk < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    else if(chunk <= 0)
+                    {
+                        return false;
+                    }
+
+                    for(ssize_t written = 0; written < chunk;)
+                    {
+                        ssize_t part = pwrite64(destination, buffer.get() + written, chunk - written, copied + written);
+
+                        if(part < 0 && errno == EINTR)
+                        {
+                            continue;
+                        }
+                        else if(part <= 0)
+                        {
+                            return false;
+                        }
+
+                        written += part;
+                    }
+
+                    copied += chunk;
+                }
+
+                return true;
+            }
+        }
+
         /*! \brief Create a file
          *
          * \param name The name of the file to create
@@ -53,7 +230,50 @@ namespace Bull
          */
         bool FileImplUnix::copy(const String& path, const String& newPath)
         {
-            return false;
+            struct stat64 info;
+            int           source = ::open64(path, O_RDONLY);
+
+            if(source == -1)
+            {
+                return false;
+            }
+
+            /// Like on Windows, an existing file is never overwritten
+            int destination = fstat64(source, &info) == 0 ? ::open64(newPath, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR) : -1;
+
+            if(destination == -1)
+            {
+                close(source);
+
+                return false;
+            }
+
+            /// Each way to copy takes over where the previous one stopped
+            Uint64 size    = info.st_size;
+            Uint64 copied  = 0;
+            bool   success = size == 0 || cloneFile(source, destination);
+
+            success = success || copyFileRange(source, destination, copied, size);
+            success = success || sendFile(source, destination, copied, size);
+            success = success || copyBuffered(source, destination, copied, size);
+
+            if(success)
+            {
+                struct timespec times[2] = {info.st_atim, info.st_mtim};
+
+                fchmod(destination, info.st_mode & 07777);
+                futimens(destination, times);
+            }
+
+            close(source);
+            success = close(destination) == 0 && success;
+
+            if(!success)
+            {
+                unlink(newPath);
+            }
+
+            return success;
         }
 
         /*! \brief Delete a file
@@ -129,7 +349,9 @@ namespace Bull
          */
         Uint64 FileImplUnix::read(void* dst, Uint64 size)
         {
-            return ::read(m_handler, dst, size);
+            ssize_t read = ::read(m_handler, dst, size);
+
+            return read > 0 ? read : 0;
         }
 
         /*! \brief Write a byte in this file
@@ -139,7 +361,9 @@ namespace Bull
          */
         Uint64 FileImplUnix::write(const void* data, Uint64 size)
         {
-            return ::write(m_handler, data, size);
+            ssize_t written = ::write(m_handler, data, size);
+
+            return written > 0 ? written : 0;
         }
 
         /*! \brief Get the date of the creation of the file
@@ -0,0 +1,182 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <Bull/Core/FileSystem/Unix/MappedFileImplUnix.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        /*! \brief Constructor
+         *
+         */
+        MappedFileImplUnix::MappedFileImplUnix() :
+            m_handler(-1),
+            m_access(MappedFile::ReadOnly),
+            m_mapping(nullptr),
+            m_mappingSize(0),
+            m_data(nullptr)
+        {
+            /// Nothing
+        }
+
+        /*! \brief Destructor
+         *
+         */
+        MappedFileImplUnix::~MappedFileImplUnix()
+        {
+            unmap();
+
+            if(m_handler != -1)
+            {
+                close(m_handler);
+            }
+        }
+
+        /*! \brief Open a file
+         *
+         * \param name   The name of the file to open
+         * \param access The Access to the mapped bytes
+         *
+         * \return Return true if the file was opened successfully, false otherwise
+         *
+         */
+        bool MappedFileImplUnix::open(const String& name, MappedFile::Access access)
+        {
+            m_access  = access;
+            m_handler = ::open64(name, access == MappedFile::ReadWrite ? O_RDWR : O_RDONLY);
+
+            return m_handler != -1;
+        }
+
+        /*! \brief Map a window of the file, the previous window is unmapped
+         *
+         * \param offset The offset in the file of the first byte to map, it does not need to be aligned
+         * \param size   The number of bytes to map, the window must lie in the file
+         *
+         * \return Return true if the window was mapped successfully, false otherwise
+         *
+         */
+        bool MappedFileImplUnix::map(Uint64 offset, Uint64 size)
+        {
+            unmap();
+
+            /// mmap refuses empty mappings, an empty window is simply not mapped
+            if(size == 0)
+            {
+                return true;
+            }
+
+            /// The mapping must start on a page boundary, the bytes before the window are mapped too
+            Uint64      pageSize = sysconf(_SC_PAGESIZE);
+            Uint64      aligned  = offset - offset % pageSize;
+            std::size_t length   = size + (offset - aligned);
+            int         prot     = m_access == MappedFile::ReadWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+            void*       mapping  = mmap64(nullptr, length, prot, MAP_SHARED, m_handler, aligned);
+
+            if(mapping == MAP_FAILED)
+            {
+                return false;
+            }
+
+            m_mapping     = mapping;
+            m_mappingSize = length;
+            m_data        = static_cast<Uint8*>(mapping) + (offset - aligned);
+
+            return true;
+        }
+
+        /*! \brief Unmap the current window
+         *
+         */
+        void MappedFileImplUnix::unmap()
+        {
+            if(m_mapping)
+            {
+                munmap(m_mapping, m_mappingSize);
+            }
+
+            m_mapping     = nullptr;
+            m_mappingSize = 0;
+            m_data        = nullptr;
+        }
+
+        /*! \brief Tell the system how the mapped bytes will be accessed
+         *
+         * \param advice The Advice to give
+         *
+         * \return Return true if the system took the advice, false otherwise or if nothing is mapped
+         *
+         */
+        bool MappedFileImplUnix::advise(MappedFile::Advice advice)
+        {
+            int flag = MADV_NORMAL;
+
+            switch(advice)
+            {
+                case MappedFile::Normal:     flag = MADV_NORMAL; break;
+                case MappedFile::Sequential: flag = MADV_SEQUENTIAL; break;
+                case MappedFile::Random:     flag = MADV_RANDOM; break;
+                case MappedFile::WillNeed:   flag = MADV_WILLNEED; break;
+                case MappedFile::HugePage:
+                #if defined MADV_HUGEPAGE
+                    flag = MADV_HUGEPAGE; break;
+                #else
+                    return false;
+                #endif
+            }
+
+            if(m_mapping)
+            {
+                return madvise(m_mapping, m_mappingSize, flag) == 0;
+            }
+
+            return false;
+        }
+
+        /*! \brief Write the changes made to the mapped bytes back into the file
+         *
+         * \return Return true if the changes were written successfully, false otherwise
+         *
+         */
+        bool MappedFileImplUnix::flush()
+        {
+            if(m_mapping && m_access == MappedFile::ReadWrite)
+            {
+                return msync(m_mapping, m_mappingSize, MS_SYNC) == 0;
+            }
+
+            return true;
+        }
+
+        /*! \brief Get the first byte of the window
+         *
+         * \return Return the first byte of the window, nullptr if nothing is mapped
+         *
+         */
+        Uint8* MappedFileImplUnix::getData() const
+        {
+            return m_data;
+        }
+
+        /*! \brief Get the size of the file
+         *
+         * \return Return the size of the file
+         *
+         */
+        Uint64 MappedFileImplUnix::getFileSize() const
+        {
+            struct stat64 info;
+
+            if(fstat64(m_handler, &info) == 0)
+            {
+                return info.st_size;
+            }
+
+            return 0;
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef Bull_MappedFileImplUnix_hpp
+#define Bull_MappedFileImplUnix_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/FileSystem/MappedFileImpl.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        class MappedFileImplUnix : public MappedFileImpl
+        {
+        public:
+
+            /*! \brief Constructor
+             *
+             */
+            MappedFileImplUnix();
+
+            /*! \brief Destructor
+             *
+             */
+            ~MappedFileImplUnix();
+
+            /*! \brief Open a file
+             *
+             * \param name   The name of the file to open
+             * \param access The Access to the mapped bytes
+             *
+             * \return Return true if the file was opened successfully, false otherwise
+             *
+             */
+            bool open(const String& name, MappedFile::Access access) override;
+
+            /*! \brief Map a window of the file, the previous window is unmapped
+             *
+             * \param offset The offset in the file of the first byte to map, it does not need to be aligned
+             * \param size   The number of bytes to map, the window must lie in the file
+             *
+             * \return Return true if the window was mapped successfully, false otherwise
+             *
+             */
+            bool map(Uint64 offset, Uint64 size) override;
+
+            /*! \brief Unmap the current window
+             *
+             */
+            void unmap() override;
+
+            /*! \brief Tell the system how the mapped bytes will be accessed
+             *
+             * \param advice The Advice to give
+             *
+             * \return Return true if the system took the advice, false otherwise or if nothing is mapped
+             *
+             */
+            bool advise(MappedFile::Advice advice) override;
+
+            /*! \brief Write the changes made to the mapped bytes back into the file
+             *
+             * \return Return true if the changes were written successfully, false otherwise
+             *
+             */
+            bool flush() override;
+
+            /*! \brief Get the first byte of the window
+             *
+             * \return Return the first byte of the window, nullptr if nothing is mapped
+             *
+             */
+            Uint8* getData() const override;
+
+            /*! \brief Get the size of the file
+             *
+             * \return Return the size of the file
+             *
+             */
+            Uint64 getFileSize() const override;
+
+        private:
+
+            int                m_handler;
+            MappedFile::Access m_access;
+            void*              m_mapping;
+            std::size_t        m_mappingSize;
+            Uint8*             m_data;
+        };
+    }
+}
+
+#endif // Bull_MappedFileImplUnix_hpp
@@ -86,6 +86,7 @@ namespace Bull
          */
         bool DirectoryImplWin32::open(const String& name)
         {
+            m_name    = name;
             m_handler = FindFirstFile(name + "\\*", &m_result);
 
             return m_handler != INVALID_HANDLE_VALUE;
@@ -107,10 +108,13 @@ namespace Bull
                 LARGE_INTEGER size;
                 FileSystemEntity ent;
 
-                ent.isDirectory = m_result.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY;
-                ent.isFile      = !ent.isDirectory;
+                /// Symbolic links and junctions are reparse points tagged as such
+                ent.isLink      = (m_result.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) &&
+                                  (m_result.dwReserved0 == IO_REPARSE_TAG_SYMLINK || m_result.dwReserved0 == IO_REPARSE_TAG_MOUNT_POINT);
+                ent.isDirectory = !ent.isLink && (m_result.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY);
+                ent.isFile      = !ent.isLink && !ent.isDirectory;
 
-                if((flags & (Directory::Directories) && ent.isDirectory) || (flags & (Directory::Files) && ent.isFile))
+                if((flags & (Directory::Directories) && ent.isDirectory) || (flags & (Directory::Files) && ent.isFile) || (flags & (Directory::Links) && ent.isLink))
                 {
                     SYSTEMTIME creationDate;
                     FileTimeToSystemTime(&m_result.ftCreationTime, &creationDate);
@@ -146,5 +150,36 @@ namespace Bull
         {
             return m_handler;
         }
+
+        /*! \brief Get what identifies the directory on the system, whatever the path used to open it
+         *
+         * \param device The device holding the directory
+         * \param index  The index of the directory on its device
+         *
+         * \return Return true if the identity was read successfully, false otherwise
+         *
+         */
+        bool DirectoryImplWin32::getIdentity(Uint64& device, Uint64& index) const
+        {
+            BY_HANDLE_FILE_INFORMATION info;
+            bool                       success = false;
+            HANDLE                     handler = CreateFile(m_name, 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+
+            if(handler == INVALID_HANDLE_VALUE)
+            {
+                return false;
+            }
+
+            if(GetFileInformationByHandle(handler, &info))
+            {
+                device  = info.dwVolumeSerialNumber;
+                index   = (static_cast<Uint64>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+                success = true;
+            }
+
+            CloseHandle(handler);
+
+            return success;
+        }
     }
 }
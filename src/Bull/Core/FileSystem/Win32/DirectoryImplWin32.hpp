@@ -81,8 +81,19 @@ namespace Bull
              */
             DirectoryHandler getSystemHandler() const override;
 
+            /*! \brief Get what identifies the directory on the system, whatever the path used to open it
+             *
+             * \param device The device holding the directory
+             * \param index  The index of the directory on its device
+             *
+             * \return Return true if the identity was read successfully, false otherwise
+             *
+             */
+            bool getIdentity(Uint64& device, Uint64& index) const override;
+
         private:
 
+            String m_name;
             HANDLE m_handler;
             WIN32_FIND_DATA m_result;
         };
@@ -0,0 +1,218 @@
+#include <Bull/Core/FileSystem/Win32/MappedFileImplWin32.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        /*! \brief Constructor
+         *
+         */
+        MappedFileImplWin32::MappedFileImplWin32() :
+            m_handler(INVALID_HANDLE_VALUE),
+            m_mapping(nullptr),
+            m_access(MappedFile::ReadOnly),
+            m_view(nullptr),
+            m_viewSize(0),
+            m_data(nullptr)
+        {
+            /// Nothing
+        }
+
+        /*! \brief Destructor
+         *
+         */
+        MappedFileImplWin32::~MappedFileImplWin32()
+        {
+            unmap();
+
+            if(m_mapping)
+            {
+                CloseHandle(m_mapping);
+            }
+
+            if(m_handler != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(m_handler);
+            }
+        }
+
+        /*! \brief Open a file
+         *
+         * \param name   The name of the file to open
+         * \param access The Access to the mapped bytes
+         *
+         * \return Return true if the file was opened successfully, false otherwise
+         *
+         */
+        bool MappedFileImplWin32::open(const String& name, MappedFile::Access access)
+        {
+            m_access  = access;
+            m_handler = CreateFile(name,
+                                   access == MappedFile::ReadWrite ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                                   FILE_SHARE_READ,
+                                   nullptr,
+                                   OPEN_EXISTING,
+                                   FILE_ATTRIBUTE_NORMAL,
+                                   nullptr);
+
+            if(m_handler == INVALID_HANDLE_VALUE)
+            {
+                return false;
+            }
+
+            /// An empty file can not be mapped but it is still a valid MappedFile
+            if(getFileSize() > 0)
+            {
+                m_mapping = CreateFileMapping(m_handler,
+                                              nullptr,
+                                              access == MappedFile::ReadWrite ? PAGE_READWRITE : PAGE_READONLY,
+                                              0,
+                                              0,
+                                              nullptr);
+
+                return m_mapping != nullptr;
+            }
+
+            return true;
+        }
+
+        /*! \brief Map a window of the file, the previous window is unmapped
+         *
+         * \param offset The offset in the file of the first byte to map, it does not need to be aligned
+         * \param size   The number of bytes to map, the window must lie in the file
+         *
+         * \return Return true if the window was mapped successfully, false otherwise
+         *
+         */
+        bool MappedFileImplWin32::map(Uint64 offset, Uint64 size)
+        {
+            unmap();
+
+            if(size == 0)
+            {
+                return true;
+            }
+
+            if(!m_mapping)
+            {
+                return false;
+            }
+
+            /// Views must start on the allocation granularity, the bytes before the window are mapped too
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+
+            Uint64 aligned = offset - offset % info.dwAllocationGranularity;
+            SIZE_T length  = static_cast<SIZE_T>(size + (offset - aligned));
+            void*  view    = MapViewOfFile(m_mapping,
+                                           m_access == MappedFile::ReadWrite ? FILE_MAP_WRITE : FILE_MAP_READ,
+                                           static_cast<DWORD>(aligned >> 32),
+                                           static_cast<DWORD>(aligned & 0xFFFFFFFF),
+                                           length);
+
+            if(!view)
+            {
+                return false;
+            }
+
+            m_view     = view;
+            m_viewSize = length;
+            m_data     = static_cast<Uint8*>(view) + (offset - aligned);
+
+            return true;
+        }
+
+        /*! \brief Unmap the current window
+         *
+         */
+        void MappedFileImplWin32::unmap()
+        {
+            if(m_view)
+            {
+                UnmapViewOfFile(m_view);
+            }
+
+            m_view     = nullptr;
+            m_viewSize = 0;
+            m_data     = nullptr;
+        }
+
+        /*! \brief Tell the system how the mapped bytes will be accessed
+         *
+         * Only WillNeed has an equivalent for views of files on Windows 8 and later
+         *
+         * \param advice The Advice to give
+         *
+         * \return Return true if the system took the advice, false otherwise or if nothing is mapped
+         *
+         */
+        bool MappedFileImplWin32::advise(MappedFile::Advice advice)
+        {
+            if(!m_view)
+            {
+                return false;
+            }
+
+            if(advice == MappedFile::Normal)
+            {
+                return true;
+            }
+
+            #if defined _WIN32_WINNT && _WIN32_WINNT >= 0x0602
+                if(advice == MappedFile::WillNeed)
+                {
+                    WIN32_MEMORY_RANGE_ENTRY range;
+
+                    range.VirtualAddress = m_view;
+                    range.NumberOfBytes  = m_viewSize;
+
+                    return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != 0;
+                }
+            #endif
+
+            return false;
+        }
+
+        /*! \brief Write the changes made to the mapped bytes back into the file
+         *
+         * \return Return true if the changes were written successfully, false otherwise
+         *
+         */
+        bool MappedFileImplWin32::flush()
+        {
+            if(m_view && m_access == MappedFile::ReadWrite)
+            {
+                return FlushViewOfFile(m_view, m_viewSize) && FlushFileBuffers(m_handler);
+            }
+
+            return true;
+        }
+
+        /*! \brief Get the first byte of the window
+         *
+         * \return Return the first byte of the window, nullptr if nothing is mapped
+         *
+         */
+        Uint8* MappedFileImplWin32::getData() const
+        {
+            return m_data;
+        }
+
+        /*! \brief Get the size of the file
+         *
+         * \return Return the size of the file
+         *
+         */
+        Uint64 MappedFileImplWin32::getFileSize() const
+        {
+            LARGE_INTEGER size;
+
+            if(GetFileSizeEx(m_handler, &size))
+            {
+                return size.QuadPart;
+            }
+
+            return 0;
+        }
+    }
+}
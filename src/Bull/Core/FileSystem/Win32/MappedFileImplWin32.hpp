@@ -0,0 +1,93 @@
+#ifndef Bull_MappedFileImplWin32_hpp
+#define Bull_MappedFileImplWin32_hpp
+
+#include <windows.h>
+
+#include <Bull/Core/FileSystem/MappedFileImpl.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        class MappedFileImplWin32 : public MappedFileImpl
+        {
+        public:
+
+            /*! \brief Constructor
+             *
+             */
+            MappedFileImplWin32();
+
+            /*! \brief Destructor
+             *
+             */
+            ~MappedFileImplWin32();
+
+            /*! \brief Open a file
+             *
+             * \param name   The name of the file to open
+             * \param access The Access to the mapped bytes
+             *
+             * \return Return true if the file was opened successfully, false otherwise
+             *
+             */
+            bool open(const String& name, MappedFile::Access access) override;
+
+            /*! \brief Map a window of the file, the previous window is unmapped
+             *
+             * \param offset The offset in the file of the first byte to map, it does not need to be aligned
+             * \param size   The number of bytes to map, the window must lie in the file
+             *
+             * \return Return true if the window was mapped successfully, false otherwise
+             *
+             */
+            bool map(Uint64 offset, Uint64 size) override;
+
+            /*! \brief Unmap the current window
+             *
+             */
+            void unmap() override;
+
+            /*! \brief Tell the system how the mapped bytes will be accessed
+             *
+             * \param advice The Advice to give
+             *
+             * \return Return true if the system took the advice, false otherwise or if nothing is mapped
+             *
+             */
+            bool advise(MappedFile::Advice advice) override;
+
+            /*! \brief Write the changes made to the mapped bytes back into the file
+             *
+             * \return Return true if the changes were written successfully, false otherwise
+             *
+             */
+            bool flush() override;
+
+            /*! \brief Get the first byte of the window
+             *
+             * \return Return the first byte of the window, nullptr if nothing is mapped
+             *
+             */
+            Uint8* getData() const override;
+
+            /*! \brief Get the size of the file
+             *
+             * \return Return the size of the file
+             *
+             */
+            Uint64 getFileSize() const override;
+
+        private:
+
+            HANDLE             m_handler;
+            HANDLE             m_mapping;
+            MappedFile::Access m_access;
+            void*              m_view;
+            SIZE_T             m_viewSize;
+            Uint8*             m_data;
+        };
+    }
+}
+
+#endif // Bull_MappedFileImplWin32_hpp
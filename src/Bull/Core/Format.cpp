@@ -0,0 +1,350 @@
+#include <cstring>
+
+#include <Bull/Core/Format.hpp>
+
+namespace Bull
+{
+    namespace
+    {
+        /// Placeholder kept as is when it has no argument
+        const StringView MissingArgument = StringView("{}", 2);
+
+        char* writeTwoDigits(char* output, unsigned int value)
+        {
+            output[0] = static_cast<char>('0' + (value / 10) % 10);
+            output[1] = static_cast<char>('0' + value % 10);
+
+            return output + 2;
+        }
+
+        /*! \brief Walk through a pattern
+         *
+         * \param pattern   The pattern to walk through
+         * \param arguments The arguments of the placeholders
+         * \param count     The number of arguments
+         * \param literal   Called with each run of characters to copy
+         * \param argument  Called with each argument to write
+         *
+         */
+        template <typename LiteralHandler, typename ArgumentHandler>
+        void walkPattern(const StringView& pattern, const prv::FormatArgument* arguments, std::size_t count, LiteralHandler literal, ArgumentHandler argument)
+        {
+            const char* data  = pattern.getData();
+            std::size_t size  = pattern.getSize();
+            std::size_t start = 0;
+            std::size_t used  = 0;
+
+            for(std::size_t i = 0; i < size; i++)
+            {
+                if((data[i] != '{' && data[i] != '}') || i + 1 == size)
+                {
+                    continue;
+                }
+
+                if(data[i] == '{' && data[i + 1] == '}')
+                {
+                    literal(data + start, i - start);
+
+                    if(used < count)
+                    {
+                        argument(arguments[used]);
+                    }
+                    else
+                    {
+                        literal(MissingArgument.getData(), MissingArgument.getSize());
+                    }
+
+                    used  += 1;
+                    start  = i + 2;
+                    i     += 1;
+                }
+                else if(data[i + 1] == data[i])
+                {
+                    /// An escaped brace, the first one is kept and the second one skipped
+                    literal(data + start, i + 1 - start);
+
+                    start  = i + 2;
+                    i     += 1;
+                }
+            }
+
+            literal(data + start, size - start);
+        }
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value The characters to write, they must outlive the Formatter
+     *
+     */
+    Formatter<StringView>::Formatter(const StringView& value) :
+        m_value(value)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Get the number of characters to write
+     *
+     * \return Return the number of characters
+     *
+     */
+    std::size_t Formatter<StringView>::getSize() const
+    {
+        return m_value.getSize();
+    }
+
+    /*! \brief Write the characters
+     *
+     * \param output The buffer to write in, it must hold getSize() characters
+     *
+     */
+    void Formatter<StringView>::write(char* output) const
+    {
+        std::memcpy(output, m_value.getData(), m_value.getSize());
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value The String to write, it must outlive the Formatter
+     *
+     */
+    Formatter<String>::Formatter(const String& value) :
+        Formatter<StringView>(value)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value The null terminated string to write, it must outlive the Formatter
+     *
+     */
+    Formatter<const char*>::Formatter(const char* value) :
+        Formatter<StringView>(value)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value The null terminated string to write, it must outlive the Formatter
+     *
+     */
+    Formatter<char*>::Formatter(const char* value) :
+        Formatter<const char*>(value)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value The character to write
+     *
+     */
+    Formatter<char>::Formatter(char value) :
+        m_value(value)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Get the number of characters to write
+     *
+     * \return Return the number of characters
+     *
+     */
+    std::size_t Formatter<char>::getSize() const
+    {
+        return 1;
+    }
+
+    /*! \brief Write the character
+     *
+     * \param output The buffer to write in, it must hold getSize() characters
+     *
+     */
+    void Formatter<char>::write(char* output) const
+    {
+        output[0] = m_value;
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value The boolean to write, as true or false
+     *
+     */
+    Formatter<bool>::Formatter(bool value) :
+        Formatter<StringView>(value ? StringView("true", 4) : StringView("false", 5))
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value The Time to write, in seconds followed by s
+     *
+     */
+    Formatter<Time>::Formatter(const Time& value)
+    {
+        m_size = String::number(value.asSeconds(), m_buffer);
+
+        m_buffer[m_size++] = 's';
+    }
+
+    /*! \brief Get the number of characters to write
+     *
+     * \return Return the number of characters
+     *
+     */
+    std::size_t Formatter<Time>::getSize() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Write the Time
+     *
+     * \param output The buffer to write in, it must hold getSize() characters
+     *
+     */
+    void Formatter<Time>::write(char* output) const
+    {
+        std::memcpy(output, m_buffer, m_size);
+    }
+
+    /*! \brief Constructor
+     *
+     * \param value The Date to write, as year/month/day hour:minute:second
+     *
+     */
+    Formatter<Date>::Formatter(const Date& value)
+    {
+        char* cursor = m_buffer + String::number(value.year, m_buffer);
+
+        *cursor++ = '/';
+        cursor    = writeTwoDigits(cursor, value.month);
+        *cursor++ = '/';
+        cursor    = writeTwoDigits(cursor, value.day);
+        *cursor++ = ' ';
+        cursor    = writeTwoDigits(cursor, value.hour);
+        *cursor++ = ':';
+        cursor    = writeTwoDigits(cursor, value.minute);
+        *cursor++ = ':';
+        cursor    = writeTwoDigits(cursor, static_cast<unsigned int>(value.second.asSeconds()));
+
+        m_size = cursor - m_buffer;
+    }
+
+    /*! \brief Get the number of characters to write
+     *
+     * \return Return the number of characters
+     *
+     */
+    std::size_t Formatter<Date>::getSize() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Write the Date
+     *
+     * \param output The buffer to write in, it must hold getSize() characters
+     *
+     */
+    void Formatter<Date>::write(char* output) const
+    {
+        std::memcpy(output, m_buffer, m_size);
+    }
+
+    namespace prv
+    {
+        /*! \brief Compute the size of a formatted text
+         *
+         * \param pattern   The pattern to format
+         * \param arguments The arguments to put instead of the placeholders
+         * \param count     The number of arguments
+         *
+         * \return Return the number of characters of the formatted text
+         *
+         */
+        std::size_t FormatEngine::getSize(const StringView& pattern, const FormatArgument* arguments, std::size_t count)
+        {
+            std::size_t size = 0;
+
+            walkPattern(pattern, arguments, count,
+                        [&size](const char*, std::size_t length)
+                        {
+                            size += length;
+                        },
+                        [&size](const FormatArgument& argument)
+                        {
+                            size += argument.size;
+                        });
+
+            return size;
+        }
+
+        /*! \brief Write a formatted text
+         *
+         * \param pattern   The pattern to format
+         * \param arguments The arguments to put instead of the placeholders
+         * \param count     The number of arguments
+         * \param output    The buffer to write in, it must hold getSize(pattern, arguments, count) characters
+         *
+         */
+        void FormatEngine::write(const StringView& pattern, const FormatArgument* arguments, std::size_t count, char* output)
+        {
+            walkPattern(pattern, arguments, count,
+                        [&output](const char* characters, std::size_t length)
+                        {
+                            std::memcpy(output, characters, length);
+                            output += length;
+                        },
+                        [&output](const FormatArgument& argument)
+                        {
+                            argument.write(argument.formatter, output);
+                            output += argument.size;
+                        });
+        }
+
+        /*! \brief Format a text into a String
+         *
+         * \param pattern   The pattern to format
+         * \param arguments The arguments to put instead of the placeholders
+         * \param count     The number of arguments
+         *
+         * \return Return the formatted String
+         *
+         */
+        String FormatEngine::format(const StringView& pattern, const FormatArgument* arguments, std::size_t count)
+        {
+            String string = String::createUninitialized(getSize(pattern, arguments, count));
+
+            write(pattern, arguments, count, string.getData());
+
+            return string;
+        }
+
+        /*! \brief Format a text into a buffer
+         *
+         * \param buffer    The buffer to write in
+         * \param capacity  The number of characters the buffer can hold
+         * \param pattern   The pattern to format
+         * \param arguments The arguments to put instead of the placeholders
+         * \param count     The number of arguments
+         *
+         * \return Return the size of the formatted text, nothing is written if it does not fit with a null character
+         *
+         */
+        std::size_t FormatEngine::formatTo(char* buffer, std::size_t capacity, const StringView& pattern, const FormatArgument* arguments, std::size_t count)
+        {
+            std::size_t size = getSize(pattern, arguments, count);
+
+            if(size < capacity)
+            {
+                write(pattern, arguments, count, buffer);
+
+                buffer[size] = String::NullByte;
+            }
+
+            return size;
+        }
+    }
+}
@@ -0,0 +1,194 @@
+#include <cstring>
+
+#include <Bull/Core/Hash/WyHash.hpp>
+
+#if defined _MSC_VER && defined _M_X64
+    #include <intrin.h>
+#endif
+
+namespace Bull
+{
+    namespace prv
+    {
+        namespace
+        {
+            const Uint64 secret[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+
+            /// Compute the 128 bits product of a and b, a receives the low part and b the high part
+            void multiply(Uint64& a, Uint64& b)
+            {
+                #if defined __SIZEOF_INT128__
+                    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+
+                    a = static_cast<Uint64>(product);
+                    b = static_cast<Uint64>(product >> 64);
+                #elif defined _MSC_VER && defined _M_X64
+                    a = _umul128(a, b, &b);
+                #else
+                    Uint64 ha = a >> 32, hb = b >> 32, la = static_cast<Uint32>(a), lb = static_cast<Uint32>(b);
+                    Uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+                    Uint64 carry = t < rl;
+                    Uint64 low = t + (rm1 << 32);
+
+                    carry += low < t;
+                    a = low;
+                    b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+                #endif
+            }
+
+            Uint64 mix(Uint64 a, Uint64 b)
+            {
+                multiply(a, b);
+
+                return a ^ b;
+            }
+
+            /// Set the ASCII uppercase letters of eight packed characters in lowercase, other characters are left as is
+            Uint64 foldWord(Uint64 word)
+            {
+                const Uint64 ones = 0x0101010101010101ull;
+                Uint64 heptets    = word & (0x7F * ones);
+                Uint64 aboveA     = heptets + (0x80 - 'A') * ones;
+                Uint64 aboveZ     = heptets + (0x80 - 'Z' - 1) * ones;
+                Uint64 upper      = aboveA & ~aboveZ & ~word & (0x80 * ones);
+
+                return word | (upper >> 2);
+            }
+
+            struct RawReader
+            {
+                static Uint64 read8(const Uint8* p)
+                {
+                    Uint64 value;
+                    std::memcpy(&value, p, sizeof(value));
+
+                    return value;
+                }
+
+                static Uint64 read4(const Uint8* p)
+                {
+                    Uint32 value;
+                    std::memcpy(&value, p, sizeof(value));
+
+                    return value;
+                }
+
+                static Uint64 read3(const Uint8* p, std::size_t size)
+                {
+                    return (static_cast<Uint64>(p[0]) << 16) | (static_cast<Uint64>(p[size >> 1]) << 8) | p[size - 1];
+                }
+            };
+
+            /// Reads the characters as if they were in lowercase, so no folded copy is needed
+            struct LowercaseReader
+            {
+                static Uint64 read8(const Uint8* p)
+                {
+                    return foldWord(RawReader::read8(p));
+                }
+
+                static Uint64 read4(const Uint8* p)
+                {
+                    return foldWord(RawReader::read4(p));
+                }
+
+                static Uint64 read3(const Uint8* p, std::size_t size)
+                {
+                    return foldWord(RawReader::read3(p, size));
+                }
+            };
+
+            template <typename Reader>
+            Uint64 hash(const Uint8* p, std::size_t size, Uint64 seed)
+            {
+                Uint64 a, b;
+
+                seed ^= mix(seed ^ secret[0], secret[1]);
+
+                if(size <= 16)
+                {
+                    if(size >= 4)
+                    {
+                        a = (Reader::read4(p) << 32) | Reader::read4(p + ((size >> 3) << 2));
+                        b = (Reader::read4(p + size - 4) << 32) | Reader::read4(p + size - 4 - ((size >> 3) << 2));
+                    }
+                    else if(size > 0)
+                    {
+                        a = Reader::read3(p, size);
+                        b = 0;
+                    }
+                    else
+                    {
+                        a = b = 0;
+                    }
+                }
+                else
+                {
+                    std::size_t remaining = size;
+
+                    if(remaining > 48)
+                    {
+                        Uint64 seed1 = seed, seed2 = seed;
+
+                        do
+                        {
+                            seed  = mix(Reader::read8(p) ^ secret[1], Reader::read8(p + 8) ^ seed);
+                            seed1 = mix(Reader::read8(p + 16) ^ secret[2], Reader::read8(p + 24) ^ seed1);
+                            seed2 = mix(Reader::read8(p + 32) ^ secret[3], Reader::read8(p + 40) ^ seed2);
+
+                            p         += 48;
+                            remaining -= 48;
+                        }while(remaining > 48);
+
+                        seed ^= seed1 ^ seed2;
+                    }
+
+                    while(remaining > 16)
+                    {
+                        seed = mix(Reader::read8(p) ^ secret[1], Reader::read8(p + 8) ^ seed);
+
+                        p         += 16;
+                        remaining -= 16;
+                    }
+
+                    a = Reader::read8(p + remaining - 16);
+                    b = Reader::read8(p + remaining - 8);
+                }
+
+                a ^= secret[1];
+                b ^= seed;
+                multiply(a, b);
+
+                return mix(a ^ secret[0] ^ size, b ^ secret[1]);
+            }
+        }
+
+        /*! \brief Hash a memory area with the wyhash algorithm
+         *
+         * \param data The memory area to hash
+         * \param size The size of the memory area
+         * \param seed The seed of the hash
+         *
+         * \return Return the hash of the memory area
+         *
+         */
+        Uint64 WyHash::compute(const void* data, std::size_t size, Uint64 seed)
+        {
+            return hash<RawReader>(static_cast<const Uint8*>(data), size, seed);
+        }
+
+        /*! \brief Hash a memory area as if its ASCII letters were in lowercase
+         *
+         * \param data The memory area to hash
+         * \param size The size of the memory area
+         * \param seed The seed of the hash
+         *
+         * \return Return the same hash as compute on the memory area set in lowercase
+         *
+         */
+        Uint64 WyHash::computeLowercase(const void* data, std::size_t size, Uint64 seed)
+        {
+            return hash<LowercaseReader>(static_cast<const Uint8*>(data), size, seed);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef Bull_WyHash_hpp
+#define Bull_WyHash_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/Integer.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct WyHash
+        {
+            /*! \brief Hash a memory area with the wyhash algorithm
+             *
+             * \param data The memory area to hash
+             * \param size The size of the memory area
+             * \param seed The seed of the hash
+             *
+             * \return Return the hash of the memory area
+             *
+             */
+            static Uint64 compute(const void* data, std::size_t size, Uint64 seed = 0);
+
+            /*! \brief Hash a memory area as if its ASCII letters were in lowercase
+             *
+             * \param data The memory area to hash
+             * \param size The size of the memory area
+             * \param seed The seed of the hash
+             *
+             * \return Return the same hash as compute on the memory area set in lowercase
+             *
+             */
+            static Uint64 computeLowercase(const void* data, std::size_t size, Uint64 seed = 0);
+        };
+    }
+}
+
+#endif // Bull_WyHash_hpp
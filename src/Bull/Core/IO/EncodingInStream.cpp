@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <cstring>
+
+#include <Bull/Core/IO/EncodingInStream.hpp>
+
+namespace Bull
+{
+    namespace
+    {
+        /// Remove spaces, tabulations and line breaks in place, return the number of characters kept
+        std::size_t removeBlanks(char* text, std::size_t size)
+        {
+            std::size_t kept = 0;
+
+            for(std::size_t i = 0; i < size; i++)
+            {
+                char character = text[i];
+
+                if(character != ' ' && character != '\t' && character != '\r' && character != '\n')
+                {
+                    text[kept++] = character;
+                }
+            }
+
+            return kept;
+        }
+    }
+
+    /*! \brief Constructor
+     *
+     * \param stream The stream to read the encoded characters from, it must outlive the EncodingInStream
+     * \param scheme The Scheme to decode with
+     *
+     */
+    EncodingInStream::EncodingInStream(InStream& stream, Encoding::Scheme scheme) :
+        m_stream(stream),
+        m_scheme(scheme),
+        m_textSize(0),
+        m_bytesBegin(0),
+        m_bytesEnd(0),
+        m_cursor(0),
+        m_isValid(true)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Read and decode characters from the wrapped stream
+     *
+     * Spaces, tabulations and line breaks between the characters are ignored
+     *
+     * \param data A pointer to the memory area to fill
+     * \param size The size of the memory area to fill
+     *
+     * \return Return the number of read bytes, less than size at the end of the wrapped stream or after an invalid character
+     *
+     */
+    Uint64 EncodingInStream::read(void* data, Uint64 size)
+    {
+        Uint8* bytes = static_cast<Uint8*>(data);
+        Uint64 read  = 0;
+
+        while(read < size)
+        {
+            if(m_bytesBegin == m_bytesEnd && !refill())
+            {
+                break;
+            }
+
+            std::size_t count = static_cast<std::size_t>(std::min<Uint64>(size - read, m_bytesEnd - m_bytesBegin));
+
+            std::memcpy(bytes + read, m_bytes + m_bytesBegin, count);
+
+            m_bytesBegin += count;
+            read         += count;
+        }
+
+        m_cursor += read;
+
+        return read;
+    }
+
+    /*! \brief Check whether every character read so far could be decoded
+     *
+     * \return Return true if no invalid character was found, false otherwise
+     *
+     */
+    bool EncodingInStream::isValid() const
+    {
+        return m_isValid;
+    }
+
+    /*! \brief Set the reading position in the stream, an EncodingInStream can not seek
+     *
+     * \param position The position to seek to
+     *
+     * \return Return the actual position
+     *
+     */
+    Uint64 EncodingInStream::setCursor(Uint64 position)
+    {
+        (void)position;
+
+        return getCursor();
+    }
+
+    /*! \brief Get the reading position in the stream
+     *
+     * \return Return the number of bytes read
+     *
+     */
+    Uint64 EncodingInStream::getCursor() const
+    {
+        return m_cursor;
+    }
+
+    /*! \brief Get the size of the stream
+     *
+     * \return Return the largest number of bytes the wrapped stream can give
+     *
+     */
+    Uint64 EncodingInStream::getSize() const
+    {
+        Uint64 text = m_textSize + (m_stream.getSize() - m_stream.getCursor());
+
+        return m_cursor + (m_bytesEnd - m_bytesBegin) + Encoding::getDecodedCapacity(static_cast<std::size_t>(text), m_scheme);
+    }
+
+    /*! \brief Read characters from the wrapped stream and decode them
+     *
+     * \return Return true if some bytes were decoded, false otherwise
+     *
+     */
+    bool EncodingInStream::refill()
+    {
+        std::size_t group = m_scheme == Encoding::Base64 ? 4 : 2;
+        bool        end   = false;
+
+        if(!m_isValid)
+        {
+            return false;
+        }
+
+        while(!end && m_textSize < group)
+        {
+            Uint64 read = m_stream.read(m_text + m_textSize, TextCapacity - m_textSize);
+
+            if(read == 0)
+            {
+                end = true;
+            }
+            else
+            {
+                m_textSize += removeBlanks(m_text + m_textSize, static_cast<std::size_t>(read));
+            }
+        }
+
+        /// Only complete groups are decoded before the end, an incomplete group at the end is reported as invalid
+        std::size_t usable = end ? m_textSize : m_textSize / group * group;
+
+        if(usable == 0)
+        {
+            return false;
+        }
+
+        ParseResult<std::size_t> result = Encoding::decode(StringView(m_text, usable), m_bytes, m_scheme);
+
+        m_isValid    = result.isValid();
+        m_bytesBegin = 0;
+        m_bytesEnd   = result.value;
+        m_textSize  -= usable;
+
+        std::memmove(m_text, m_text + usable, m_textSize);
+
+        return m_bytesEnd > 0;
+    }
+}
@@ -0,0 +1,135 @@
+#include <algorithm>
+
+#include <Bull/Core/IO/EncodingOutStream.hpp>
+
+namespace Bull
+{
+    /*! \brief Constructor
+     *
+     * \param stream The stream to write the encoded characters to, it must outlive the EncodingOutStream
+     * \param scheme The Scheme to encode with
+     *
+     */
+    EncodingOutStream::EncodingOutStream(OutStream& stream, Encoding::Scheme scheme) :
+        m_stream(stream),
+        m_scheme(scheme),
+        m_pendingSize(0),
+        m_size(0)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Destructor
+     *
+     */
+    EncodingOutStream::~EncodingOutStream()
+    {
+        finish();
+    }
+
+    /*! \brief Encode bytes and write them into the wrapped stream
+     *
+     * \param data A pointer to the memory area to encode
+     * \param size The size of the memory area to encode
+     *
+     * \return Return the number of bytes taken, bytes which do not complete a group are kept until the next write
+     *
+     */
+    Uint64 EncodingOutStream::write(const void* data, Uint64 size)
+    {
+        const Uint8* bytes  = static_cast<const Uint8*>(data);
+        std::size_t  length = static_cast<std::size_t>(size);
+        std::size_t  group  = m_scheme == Encoding::Base64 ? 3 : 1;
+        char         text[4096];
+
+        m_size += length;
+
+        if(m_pendingSize > 0)
+        {
+            while(m_pendingSize < group && length > 0)
+            {
+                m_pending[m_pendingSize++] = *bytes++;
+                length -= 1;
+            }
+
+            if(m_pendingSize < group)
+            {
+                return size;
+            }
+
+            m_stream.write(text, Encoding::encode(m_pending, m_pendingSize, text, m_scheme));
+            m_pendingSize = 0;
+        }
+
+        /// Encoded by blocks small enough to stay in the cache, only complete groups are encoded before the end
+        const std::size_t block = Encoding::getDecodedCapacity(sizeof(text), m_scheme);
+
+        while(length >= group)
+        {
+            std::size_t count = std::min(length, block) / group * group;
+
+            m_stream.write(text, Encoding::encode(bytes, count, text, m_scheme));
+
+            bytes  += count;
+            length -= count;
+        }
+
+        while(length > 0)
+        {
+            m_pending[m_pendingSize++] = *bytes++;
+            length -= 1;
+        }
+
+        return size;
+    }
+
+    /*! \brief Encode the bytes kept by the stream, with padding
+     *
+     * The next bytes written start a new encoded text
+     *
+     */
+    void EncodingOutStream::finish()
+    {
+        if(m_pendingSize > 0)
+        {
+            char text[4];
+
+            m_stream.write(text, Encoding::encode(m_pending, m_pendingSize, text, m_scheme));
+            m_pendingSize = 0;
+        }
+    }
+
+    /*! \brief Set the writing position in the stream, an EncodingOutStream can not seek
+     *
+     * \param position The position to seek to
+     *
+     * \return Return the actual position
+     *
+     */
+    Uint64 EncodingOutStream::setCursor(Uint64 position)
+    {
+        (void)position;
+
+        return getCursor();
+    }
+
+    /*! \brief Get the writing position in the stream
+     *
+     * \return Return the number of bytes taken
+     *
+     */
+    Uint64 EncodingOutStream::getCursor() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Get the size of the stream
+     *
+     * \return Return the number of bytes taken
+     *
+     */
+    Uint64 EncodingOutStream::getSize() const
+    {
+        return m_size;
+    }
+}
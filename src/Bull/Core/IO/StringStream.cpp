@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cstring>
+
 #include <Bull/Core/IO/StringStream.hpp>
 
 namespace Bull
@@ -6,18 +9,82 @@ namespace Bull
      *
      */
     StringStream::StringStream() :
-        m_bufferSize(0)
+        m_cursor(0)
     {
         /// Nothing
     }
 
-    /*! \brief Empty the stream content
+    /*! \brief Constructor
+     *
+     * \param capacity The number of characters to reserve
+     *
+     */
+    StringStream::StringStream(std::size_t capacity) :
+        m_cursor(0)
+    {
+        m_buffer.reserve(capacity);
+    }
+
+    /*! \brief Empty the stream content, its memory is kept to be reused
      *
      */
     void StringStream::clear()
     {
-        m_content.clear();
-        m_bufferSize = 0;
+        m_cursor = 0;
+
+        if(m_buffer.isUniquelyOwned())
+        {
+            m_buffer.setSizeInPlace(0);
+        }
+        else
+        {
+            m_buffer = String();
+        }
+    }
+
+    /*! \brief Write data into the stream at the cursor
+     *
+     * \param data A pointer to the memory area to write
+     * \param size The size of the memory area to write
+     *
+     * \return Return the number of written bytes
+     *
+     */
+    Uint64 StringStream::write(const void* data, Uint64 size)
+    {
+        std::size_t length = static_cast<std::size_t>(size);
+
+        if(length > 0)
+        {
+            std::memcpy(prepareWrite(length), data, length);
+            commitWrite(length);
+        }
+
+        return size;
+    }
+
+    /*! \brief Set the writing position in the stream
+     *
+     * \param position The position to seek to
+     *
+     * \return Return the actual position, which cannot be past the end of the content
+     *
+     */
+    Uint64 StringStream::setCursor(Uint64 position)
+    {
+        m_cursor = static_cast<std::size_t>(std::min<Uint64>(position, m_buffer.getSize()));
+
+        return m_cursor;
+    }
+
+    /*! \brief Get the writing position in the stream
+     *
+     * \return Return the current position
+     *
+     */
+    Uint64 StringStream::getCursor() const
+    {
+        return m_cursor;
     }
 
     /*! \brief Get the size of the content of the stream
@@ -25,27 +92,34 @@ namespace Bull
      * \return Return the size of the content of the stream
      *
      */
-    std::size_t StringStream::getSize() const
+    Uint64 StringStream::getSize() const
     {
-        return m_bufferSize;
+        return m_buffer.getSize();
     }
 
     /*! \brief Get the content of the stream
      *
-     * \return Return the content of the stream
+     * \return Return the content of the stream, sharing the buffer until the stream is written again
      *
      */
     String StringStream::toString() const
     {
-        String str;
-        str.reserve(m_bufferSize);
+        return m_buffer;
+    }
 
-        for(const String& chuck : m_content)
-        {
-            str += chuck;
-        }
+    /*! \brief Take the content of the stream without copying it
+     *
+     * \return Return the content of the stream, which is empty afterward
+     *
+     */
+    String StringStream::release()
+    {
+        String content = std::move(m_buffer);
 
-        return str;
+        m_buffer = String();
+        m_cursor = 0;
+
+        return content;
     }
 
     /*! \brief Adds the representation of an integer
@@ -57,10 +131,91 @@ namespace Bull
      */
     StringStream& StringStream::operator<<(int right)
     {
-        m_content.push_back(String::number(right));
-        m_bufferSize += m_content.back().getSize();
+        return writeNumber(static_cast<Int64>(right));
+    }
 
-        return (*this);
+    /*! \brief Adds the representation of an integer
+     *
+     * \param right The integer to add
+     *
+     * \return Return a reference to this
+     *
+     */
+    StringStream& StringStream::operator<<(unsigned int right)
+    {
+        return writeNumber(static_cast<Uint64>(right));
+    }
+
+    /*! \brief Adds the representation of an integer
+     *
+     * \param right The integer to add
+     *
+     * \return Return a reference to this
+     *
+     */
+    StringStream& StringStream::operator<<(long right)
+    {
+        return writeNumber(static_cast<Int64>(right));
+    }
+
+    /*! \brief Adds the representation of an integer
+     *
+     * \param right The integer to add
+     *
+     * \return Return a reference to this
+     *
+     */
+    StringStream& StringStream::operator<<(unsigned long right)
+    {
+        return writeNumber(static_cast<Uint64>(right));
+    }
+
+    /*! \brief Adds the representation of an integer
+     *
+     * \param right The integer to add
+     *
+     * \return Return a reference to this
+     *
+     */
+    StringStream& StringStream::operator<<(long long right)
+    {
+        return writeNumber(static_cast<Int64>(right));
+    }
+
+    /*! \brief Adds the representation of an integer
+     *
+     * \param right The integer to add
+     *
+     * \return Return a reference to this
+     *
+     */
+    StringStream& StringStream::operator<<(unsigned long long right)
+    {
+        return writeNumber(static_cast<Uint64>(right));
+    }
+
+    /*! \brief Adds the representation of a floating point number
+     *
+     * \param right The number to add
+     *
+     * \return Return a reference to this
+     *
+     */
+    StringStream& StringStream::operator<<(float right)
+    {
+        return writeNumber(right);
+    }
+
+    /*! \brief Adds the representation of a floating point number
+     *
+     * \param right The number to add
+     *
+     * \return Return a reference to this
+     *
+     */
+    StringStream& StringStream::operator<<(double right)
+    {
+        return writeNumber(right);
     }
 
     /*! \brief Adds the representation of a boolean
@@ -72,10 +227,7 @@ namespace Bull
      */
     StringStream& StringStream::operator<<(bool right)
     {
-        m_content.push_back(String::boolean(right));
-        m_bufferSize += m_content.back().getSize();
-
-        return (*this);
+        return (*this) << (right ? StringView("true", 4) : StringView("false", 5));
     }
 
     /*! \brief Adds the representation of an char
@@ -87,8 +239,8 @@ namespace Bull
      */
     StringStream& StringStream::operator<<(char right)
     {
-        m_content.push_back(String(right));
-        m_bufferSize += m_content.back().getSize();
+        *prepareWrite(1) = right;
+        commitWrite(1);
 
         return (*this);
     }
@@ -102,10 +254,7 @@ namespace Bull
      */
     StringStream& StringStream::operator<<(const char* right)
     {
-        m_content.push_back(String(right));
-        m_bufferSize += m_content.back().getSize();
-
-        return (*this);
+        return (*this) << StringView(right);
     }
 
     /*! \brief Adds the representation of a String
@@ -117,8 +266,19 @@ namespace Bull
      */
     StringStream& StringStream::operator<<(const String& right)
     {
-        m_content.push_back(right);
-        m_bufferSize += m_content.back().getSize();
+        return (*this) << StringView(right);
+    }
+
+    /*! \brief Adds the viewed characters
+     *
+     * \param right The StringView to add
+     *
+     * \return Return a reference to this
+     *
+     */
+    StringStream& StringStream::operator<<(const StringView& right)
+    {
+        write(right.getData(), right.getSize());
 
         return (*this);
     }
@@ -132,4 +292,58 @@ namespace Bull
     {
         return toString();
     }
+
+    /*! \brief Make room for characters at the cursor
+     *
+     * \param size The number of characters to write
+     *
+     * \return Return where to write the characters
+     *
+     */
+    char* StringStream::prepareWrite(std::size_t size)
+    {
+        return m_buffer.prepareWrite(m_cursor + size) + m_cursor;
+    }
+
+    /*! \brief Move the cursor after written characters
+     *
+     * \param size The number of characters written at the cursor
+     *
+     */
+    void StringStream::commitWrite(std::size_t size)
+    {
+        m_cursor += size;
+
+        if(m_cursor > m_buffer.getSize())
+        {
+            m_buffer.setSizeInPlace(m_cursor);
+        }
+    }
+
+    /*! \brief Write a number at the cursor
+     *
+     * \param number The number to write
+     *
+     * \return Return a reference to this
+     *
+     */
+    template <typename T>
+    StringStream& StringStream::writeNumber(T number)
+    {
+        if(m_cursor == m_buffer.getSize())
+        {
+            /// At the end of the content the number is formatted straight into the buffer
+            commitWrite(String::number(number, prepareWrite(String::NumberCapacity)));
+        }
+        else
+        {
+            char        buffer[String::NumberCapacity];
+            std::size_t size = String::number(number, buffer);
+
+            std::memcpy(prepareWrite(size), buffer, size);
+            commitWrite(size);
+        }
+
+        return (*this);
+    }
 }
@@ -0,0 +1,188 @@
+#include <cstring>
+
+#include <Bull/Core/Hash/WyHash.hpp>
+#include <Bull/Core/InternTable.hpp>
+#include <Bull/Core/Thread/Lock.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        namespace
+        {
+            const std::size_t InitialCapacity = 1024;
+        }
+
+        /*! \brief Get the table shared by all InternedStrings
+         *
+         * \return Return the table
+         *
+         */
+        InternTable& InternTable::getInstance()
+        {
+            static InternTable instance;
+
+            return instance;
+        }
+
+        /*! \brief Constructor
+         *
+         */
+        InternTable::InternTable() :
+            m_memory(0),
+            m_lookups(0),
+            m_hits(0)
+        {
+            m_allSlots.emplace_back(new Slots(InitialCapacity));
+            m_slots.store(m_allSlots.back().get(), std::memory_order_release);
+            m_memory += InitialCapacity * sizeof(std::atomic<const InternEntry*>);
+        }
+
+        /*! \brief Find or add a string in the table
+         *
+         * Looking up a string already in the table does not lock
+         *
+         * \param string The string to intern
+         *
+         * \return Return the entry of the string, which is never freed
+         *
+         */
+        const InternEntry* InternTable::intern(const StringView& string)
+        {
+            std::size_t hash = static_cast<std::size_t>(WyHash::compute(string.getData(), string.getSize()));
+            const InternEntry* entry = find(*m_slots.load(std::memory_order_acquire), string, hash);
+
+            m_lookups.fetch_add(1, std::memory_order_relaxed);
+
+            if(entry)
+            {
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+
+                return entry;
+            }
+
+            Lock lock(m_mutex);
+
+            /// Another thread could have added the string since the first lookup
+            entry = find(*m_slots.load(std::memory_order_relaxed), string, hash);
+
+            if(entry)
+            {
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+
+                return entry;
+            }
+
+            if((m_entries.size() + 1) * 4 > (m_slots.load(std::memory_order_relaxed)->mask + 1) * 3)
+            {
+                grow();
+            }
+
+            std::unique_ptr<InternEntry> newEntry(new InternEntry{string.toString(), hash});
+
+            m_memory += sizeof(InternEntry);
+
+            if(string.getSize() > String::SmallCapacity)
+            {
+                m_memory += newEntry->string.getCapacity() + 1;
+            }
+
+            insert(*m_slots.load(std::memory_order_relaxed), newEntry.get());
+            m_entries.push_back(std::move(newEntry));
+
+            return m_entries.back().get();
+        }
+
+        /*! \brief Get the statistics of the table
+         *
+         * \return Return the statistics
+         *
+         */
+        InternedString::Statistics InternTable::getStatistics() const
+        {
+            Lock lock(m_mutex);
+            InternedString::Statistics statistics;
+
+            statistics.count   = m_entries.size();
+            statistics.memory  = m_memory + m_entries.capacity() * sizeof(std::unique_ptr<InternEntry>);
+            statistics.lookups = m_lookups.load(std::memory_order_relaxed);
+            statistics.hits    = m_hits.load(std::memory_order_relaxed);
+
+            return statistics;
+        }
+
+        InternTable::Slots::Slots(std::size_t capacity) :
+            mask(capacity - 1),
+            entries(new std::atomic<const InternEntry*>[capacity])
+        {
+            for(std::size_t i = 0; i < capacity; i++)
+            {
+                entries[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        /*! \brief Find a string in a table
+         *
+         * \param slots  The table to search in
+         * \param string The string to find
+         * \param hash   The hash of the string
+         *
+         * \return Return the entry of the string, nullptr if the string is not in the table
+         *
+         */
+        const InternEntry* InternTable::find(const Slots& slots, const StringView& string, std::size_t hash)
+        {
+            for(std::size_t i = hash & slots.mask; ; i = (i + 1) & slots.mask)
+            {
+                const InternEntry* entry = slots.entries[i].load(std::memory_order_acquire);
+
+                if(!entry)
+                {
+                    return nullptr;
+                }
+
+                if(entry->hash == hash && entry->string.getSize() == string.getSize() &&
+                   std::memcmp(static_cast<const char*>(entry->string), string.getData(), string.getSize()) == 0)
+                {
+                    return entry;
+                }
+            }
+        }
+
+        /*! \brief Put an entry in the first empty slot of its probe sequence
+         *
+         * \param slots The table to fill
+         * \param entry The entry to insert
+         *
+         */
+        void InternTable::insert(Slots& slots, const InternEntry* entry)
+        {
+            std::size_t i = entry->hash & slots.mask;
+
+            while(slots.entries[i].load(std::memory_order_relaxed))
+            {
+                i = (i + 1) & slots.mask;
+            }
+
+            slots.entries[i].store(entry, std::memory_order_release);
+        }
+
+        /*! \brief Replace the table by one twice bigger
+         *
+         */
+        void InternTable::grow()
+        {
+            std::size_t capacity = (m_slots.load(std::memory_order_relaxed)->mask + 1) * 2;
+            std::unique_ptr<Slots> slots(new Slots(capacity));
+
+            for(const std::unique_ptr<InternEntry>& entry : m_entries)
+            {
+                insert(*slots, entry.get());
+            }
+
+            m_memory += capacity * sizeof(std::atomic<const InternEntry*>);
+            m_slots.store(slots.get(), std::memory_order_release);
+            m_allSlots.push_back(std::move(slots));
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#ifndef Bull_InternTable_hpp
+#define Bull_InternTable_hpp
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <Bull/Core/InternedString.hpp>
+#include <Bull/Core/Pattern/NonCopyable.hpp>
+#include <Bull/Core/Thread/Mutex.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct InternEntry
+        {
+            String      string;
+            std::size_t hash;
+        };
+
+        class InternTable : public NonCopyable
+        {
+        public:
+
+            /*! \brief Get the table shared by all InternedStrings
+             *
+             * \return Return the table
+             *
+             */
+            static InternTable& getInstance();
+
+        public:
+
+            /*! \brief Constructor
+             *
+             */
+            InternTable();
+
+            /*! \brief Find or add a string in the table
+             *
+             * Looking up a string already in the table does not lock
+             *
+             * \param string The string to intern
+             *
+             * \return Return the entry of the string, which is never freed
+             *
+             */
+            const InternEntry* intern(const StringView& string);
+
+            /*! \brief Get the statistics of the table
+             *
+             * \return Return the statistics
+             *
+             */
+            InternedString::Statistics getStatistics() const;
+
+        private:
+
+            /// Open addressing table, a published Slots is never modified except to fill an empty slot
+            struct Slots
+            {
+                Slots(std::size_t capacity);
+
+                std::size_t                                        mask;
+                std::unique_ptr<std::atomic<const InternEntry*>[]> entries;
+            };
+
+            /*! \brief Find a string in a table
+             *
+             * \param slots  The table to search in
+             * \param string The string to find
+             * \param hash   The hash of the string
+             *
+             * \return Return the entry of the string, nullptr if the string is not in the table
+             *
+             */
+            static const InternEntry* find(const Slots& slots, const StringView& string, std::size_t hash);
+
+            /*! \brief Put an entry in the first empty slot of its probe sequence
+             *
+             * \param slots The table to fill
+             * \param entry The entry to insert
+             *
+             */
+            static void insert(Slots& slots, const InternEntry* entry);
+
+            /*! \brief Replace the table by one twice bigger
+             *
+             */
+            void grow();
+
+            std::atomic<Slots*>                       m_slots;
+            std::vector<std::unique_ptr<Slots>>       m_allSlots; /*!< Old tables stay alive since readers may still be using them */
+            std::vector<std::unique_ptr<InternEntry>> m_entries;
+            std::size_t                               m_memory;
+            std::atomic<Uint64>                       m_lookups;
+            std::atomic<Uint64>                       m_hits;
+            mutable Mutex                             m_mutex;
+        };
+    }
+}
+
+#endif // Bull_InternTable_hpp
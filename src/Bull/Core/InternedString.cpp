@@ -0,0 +1,137 @@
+#include <functional>
+
+#include <Bull/Core/InternedString.hpp>
+#include <Bull/Core/InternTable.hpp>
+
+namespace Bull
+{
+    /*! \brief Get the rate of lookups which found an already interned string
+     *
+     * \return Return the hit rate, between 0 and 1
+     *
+     */
+    float InternedString::Statistics::getHitRate() const
+    {
+        if(lookups == 0)
+        {
+            return 0.f;
+        }
+
+        return static_cast<float>(hits) / static_cast<float>(lookups);
+    }
+
+    /*! \brief Get the statistics of the interning table
+     *
+     * \return Return the statistics
+     *
+     */
+    InternedString::Statistics InternedString::getStatistics()
+    {
+        return prv::InternTable::getInstance().getStatistics();
+    }
+
+    /*! \brief Default constructor
+     *
+     * The default InternedString is the empty string
+     *
+     */
+    InternedString::InternedString() :
+        m_entry(nullptr)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string The string to intern
+     *
+     */
+    InternedString::InternedString(const StringView& string) :
+        m_entry(string.isEmpty() ? nullptr : prv::InternTable::getInstance().intern(string))
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string The string to intern
+     *
+     */
+    InternedString::InternedString(const char* string) :
+        InternedString(StringView(string))
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string The string to intern
+     *
+     */
+    InternedString::InternedString(const String& string) :
+        InternedString(StringView(string))
+    {
+        /// Nothing
+    }
+
+    /*! \brief Get the interned string
+     *
+     * \return Return the interned string, which lives until the end of the program
+     *
+     */
+    const String& InternedString::toString() const
+    {
+        static const String empty;
+
+        return m_entry ? m_entry->string : empty;
+    }
+
+    /*! \brief Get the hash of the interned string
+     *
+     * \return Return the hash computed when the string was interned
+     *
+     */
+    std::size_t InternedString::getHash() const
+    {
+        return m_entry ? m_entry->hash : 0;
+    }
+
+    /*! \brief Compare two InternedStrings
+     *
+     * \param left  The first InternedString to compare
+     * \param right The second InternedString to compare
+     *
+     * \return Return true if left and right are the same string, false otherwise
+     *
+     */
+    bool operator==(const InternedString& left, const InternedString& right)
+    {
+        return left.m_entry == right.m_entry;
+    }
+
+    /*! \brief Compare two InternedStrings
+     *
+     * \param left  The first InternedString to compare
+     * \param right The second InternedString to compare
+     *
+     * \return Return true if left and right are different strings, false otherwise
+     *
+     */
+    bool operator!=(const InternedString& left, const InternedString& right)
+    {
+        return left.m_entry != right.m_entry;
+    }
+
+    /*! \brief Order two InternedStrings by identity, the order is not lexicographic and changes between runs
+     *
+     * \param left  The first InternedString to compare
+     * \param right The second InternedString to compare
+     *
+     * \return Return true if left is ordered before right, false otherwise
+     *
+     */
+    bool operator<(const InternedString& left, const InternedString& right)
+    {
+        return std::less<const prv::InternEntry*>()(left.m_entry, right.m_entry);
+    }
+}
@@ -0,0 +1,238 @@
+#include <queue>
+
+#include <Bull/Core/KeywordSearcher.hpp>
+
+/// The keywords are compiled in an Aho-Corasick automaton whose missing transitions are
+/// all resolved at construction, so the search reads a single table entry per character
+
+namespace Bull
+{
+    constexpr Uint32 KeywordSearcher::NoKeyword;
+
+    /*! \brief Constructor
+     *
+     * \param keywords The keywords to search, empty keywords are ignored
+     *
+     */
+    KeywordSearcher::KeywordSearcher(std::initializer_list<StringView> keywords)
+    {
+        createState();
+
+        for(const StringView& keyword : keywords)
+        {
+            addKeyword(keyword);
+        }
+
+        build();
+    }
+
+    /*! \brief Constructor
+     *
+     * \param keywords The keywords to search, empty keywords are ignored
+     *
+     */
+    KeywordSearcher::KeywordSearcher(const std::vector<String>& keywords)
+    {
+        createState();
+
+        for(const String& keyword : keywords)
+        {
+            addKeyword(keyword);
+        }
+
+        build();
+    }
+
+    /*! \brief Find every occurrence of every keyword in a single pass over a text
+     *
+     * \param text The text to search in
+     *
+     * \return Return the occurrences, ordered by the position where they end
+     *
+     */
+    std::vector<KeywordSearcher::Match> KeywordSearcher::findAll(const StringView& text) const
+    {
+        std::vector<Match> matches;
+        const char* data = text.getData();
+        Uint32 state     = 0;
+
+        for(std::size_t i = 0; i < text.getSize(); i++)
+        {
+            state = m_transitions[state * 256 + static_cast<Uint8>(data[i])];
+
+            Uint32 output = (m_keywordEnds[state] != NoKeyword) ? state : m_outputLinks[state];
+
+            while(output)
+            {
+                Uint32 keyword = m_keywordEnds[output];
+
+                matches.push_back(Match{keyword, i + 1 - m_keywords[keyword].getSize()});
+
+                output = m_outputLinks[output];
+            }
+        }
+
+        return matches;
+    }
+
+    /*! \brief Find the occurrence of a keyword which ends first in a text
+     *
+     * \param text  The text to search in
+     * \param match The Match to fill with the occurrence
+     *
+     * \return Return true if a keyword was found, false otherwise
+     *
+     */
+    bool KeywordSearcher::findFirst(const StringView& text, Match& match) const
+    {
+        const char* data = text.getData();
+        Uint32 state     = 0;
+
+        for(std::size_t i = 0; i < text.getSize(); i++)
+        {
+            state = m_transitions[state * 256 + static_cast<Uint8>(data[i])];
+
+            Uint32 output = (m_keywordEnds[state] != NoKeyword) ? state : m_outputLinks[state];
+
+            if(output)
+            {
+                match.keyword  = m_keywordEnds[output];
+                match.position = i + 1 - m_keywords[match.keyword].getSize();
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /*! \brief Check whether a text contains any of the keywords
+     *
+     * \param text The text to search in
+     *
+     * \return Return true if a keyword was found, false otherwise
+     *
+     */
+    bool KeywordSearcher::containsAny(const StringView& text) const
+    {
+        Match match;
+
+        return findFirst(text, match);
+    }
+
+    /*! \brief Get the number of keywords
+     *
+     * \return Return the number of keywords
+     *
+     */
+    std::size_t KeywordSearcher::getKeywordCount() const
+    {
+        return m_keywords.size();
+    }
+
+    /*! \brief Get a keyword
+     *
+     * \param index The index of the keyword
+     *
+     * \return Return the keyword
+     *
+     */
+    const String& KeywordSearcher::getKeyword(std::size_t index) const
+    {
+        return m_keywords[index];
+    }
+
+    /*! \brief Add a keyword to the trie
+     *
+     * \param keyword The keyword to add
+     *
+     */
+    void KeywordSearcher::addKeyword(const StringView& keyword)
+    {
+        Uint32 state = 0;
+
+        m_keywords.push_back(keyword.toString());
+
+        if(keyword.isEmpty())
+        {
+            return;
+        }
+
+        for(std::size_t i = 0; i < keyword.getSize(); i++)
+        {
+            std::size_t transition = state * 256 + static_cast<Uint8>(keyword[i]);
+
+            /// While the trie is built, 0 means no transition since no edge goes back to the root
+            if(!m_transitions[transition])
+            {
+                Uint32 next = createState();
+
+                m_transitions[transition] = next;
+            }
+
+            state = m_transitions[transition];
+        }
+
+        /// A duplicated keyword is always reported with its first index
+        if(m_keywordEnds[state] == NoKeyword)
+        {
+            m_keywordEnds[state] = static_cast<Uint32>(m_keywords.size() - 1);
+        }
+    }
+
+    /*! \brief Compute the failure transitions to turn the trie into an automaton
+     *
+     */
+    void KeywordSearcher::build()
+    {
+        std::vector<Uint32> failures(m_keywordEnds.size(), 0);
+        std::queue<Uint32> states;
+
+        for(std::size_t character = 0; character < 256; character++)
+        {
+            if(m_transitions[character])
+            {
+                states.push(m_transitions[character]);
+            }
+        }
+
+        /// Breadth first, so the failure state of a state is always complete before the state itself
+        while(!states.empty())
+        {
+            Uint32 state = states.front();
+            states.pop();
+
+            for(std::size_t character = 0; character < 256; character++)
+            {
+                Uint32& transition = m_transitions[state * 256 + character];
+                Uint32  fallback   = m_transitions[failures[state] * 256 + character];
+
+                if(transition)
+                {
+                    failures[transition]      = fallback;
+                    m_outputLinks[transition] = (m_keywordEnds[fallback] != NoKeyword) ? fallback : m_outputLinks[fallback];
+
+                    states.push(transition);
+                }
+                else
+                {
+                    transition = fallback;
+                }
+            }
+        }
+    }
+
+    /*! \brief Add a state without transition
+     *
+     * \return Return the index of the state
+     *
+     */
+    Uint32 KeywordSearcher::createState()
+    {
+        m_transitions.resize(m_transitions.size() + 256, 0);
+        m_keywordEnds.push_back(NoKeyword);
+        m_outputLinks.push_back(0);
+
+        return static_cast<Uint32>(m_keywordEnds.size() - 1);
+    }
+}
@@ -9,6 +9,8 @@ namespace Bull
         m_fileName("BullApp.log")
     {
         m_log.open(m_fileName, File::OpeningMode::Write);
+        m_log.setWriteBufferSize(4096);
+        m_log.setFlushInterval(Time::seconds(1.f));
     }
 
     /*! \brief Destructor
@@ -26,7 +28,7 @@ namespace Bull
      */
     void Log::info(const String& message)
     {
-        m_log.write("[Information] " + message + "\n");
+        m_log.write(String::concat("[Information] ", message, "\n"));
     }
 
     /*! \brief Add a notice entry in the log
@@ -36,7 +38,7 @@ namespace Bull
      */
     void Log::notice(const String& message)
     {
-        m_log.write("[Notice] " + message + "\n");
+        m_log.write(String::concat("[Notice] ", message, "\n"));
     }
 
     /*! \brief Add a warning entry in the log
@@ -46,7 +48,7 @@ namespace Bull
      */
     void Log::warning(const String& message)
     {
-        m_log.write("[Warning] " + message + "\n");
+        m_log.write(String::concat("[Warning] ", message, "\n"));
     }
 
     /*! \brief Add an error entry in the log
@@ -56,7 +58,10 @@ namespace Bull
      */
     void Log::error(const String& message)
     {
-        m_log.write("[Error] " + message + "\n");
+        m_log.write(String::concat("[Error] ", message, "\n"));
+
+        /// Do not lose serious messages if the application crashes right after
+        m_log.flush();
     }
 
     /*! \brief Add a critical entry in the log
@@ -66,7 +71,8 @@ namespace Bull
      */
     void Log::critical(const String& message)
     {
-        m_log.write("[Critical] " + message + "\n");
+        m_log.write(String::concat("[Critical] ", message, "\n"));
+        m_log.flush();
     }
 
     /*! \brief Add an alert entry in the log
@@ -76,7 +82,8 @@ namespace Bull
      */
     void Log::alert(const String& message)
     {
-        m_log.write("[Alert] " + message + "\n");
+        m_log.write(String::concat("[Alert] ", message, "\n"));
+        m_log.flush();
     }
 
     /*! \brief Add an emergency entry in the log
@@ -86,7 +93,8 @@ namespace Bull
      */
     void Log::emergency(const String& message)
     {
-        m_log.write("[Emergency] " + message + "\n");
+        m_log.write(String::concat("[Emergency] ", message, "\n"));
+        m_log.flush();
     }
 
     /*! \brief Add a new entry in the log
@@ -118,5 +126,7 @@ namespace Bull
         m_fileName(fileName)
     {
         m_log.open(m_fileName, File::OpeningMode::Write);
+        m_log.setWriteBufferSize(4096);
+        m_log.setFlushInterval(Time::seconds(1.f));
     }
 }
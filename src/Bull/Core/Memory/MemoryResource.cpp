@@ -0,0 +1,39 @@
+#include <new>
+
+#include <Bull/Core/Memory/MemoryResource.hpp>
+
+namespace Bull
+{
+    namespace
+    {
+        struct HeapResource : public MemoryResource
+        {
+            void* allocate(std::size_t size, std::size_t alignment)
+            {
+                (void)alignment;
+
+                return ::operator new(size);
+            }
+
+            void deallocate(void* pointer, std::size_t size, std::size_t alignment)
+            {
+                (void)size;
+                (void)alignment;
+
+                ::operator delete(pointer);
+            }
+        };
+    }
+
+    /*! \brief Get the MemoryResource using the global heap
+     *
+     * \return Return the default MemoryResource
+     *
+     */
+    MemoryResource& MemoryResource::getDefault()
+    {
+        static HeapResource resource;
+
+        return resource;
+    }
+}
@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#include <Bull/Core/Memory/ScratchArena.hpp>
+
+namespace Bull
+{
+    constexpr std::size_t ScratchArena::DefaultBlockSize;
+
+    /*! \brief Constructor
+     *
+     * \param blockSize The size of the first block of memory
+     *
+     */
+    ScratchArena::ScratchArena(std::size_t blockSize) :
+        m_block(nullptr),
+        m_cursor(nullptr),
+        m_end(nullptr),
+        m_used(0),
+        m_capacity(0),
+        m_liveAllocations(0),
+        m_frame(0)
+    {
+        pushBlock(blockSize);
+    }
+
+    /*! \brief Destructor
+     *
+     */
+    ScratchArena::~ScratchArena()
+    {
+        releaseBlocks();
+    }
+
+    /*! \brief Allocate a memory area in the current block, or in a new one when it is full
+     *
+     * \param size      The size of the memory area
+     * \param alignment The alignment of the memory area, a power of two
+     *
+     * \return Return a pointer to the memory area
+     *
+     */
+    void* ScratchArena::allocate(std::size_t size, std::size_t alignment)
+    {
+        std::uintptr_t cursor  = reinterpret_cast<std::uintptr_t>(m_cursor);
+        std::uintptr_t aligned = (cursor + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+
+        if(aligned + size > reinterpret_cast<std::uintptr_t>(m_end))
+        {
+            pushBlock(std::max(size + alignment, m_block->size * 2));
+
+            cursor  = reinterpret_cast<std::uintptr_t>(m_cursor);
+            aligned = (cursor + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        }
+
+        m_cursor           = reinterpret_cast<char*>(aligned + size);
+        m_used            += aligned + size - cursor;
+        m_liveAllocations += 1;
+
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /*! \brief Forget an allocation, its memory is only reused after reset
+     *
+     * \param pointer   The pointer to the memory area
+     * \param size      The size given when the memory area was allocated
+     * \param alignment The alignment given when the memory area was allocated
+     *
+     */
+    void ScratchArena::deallocate(void* pointer, std::size_t size, std::size_t alignment)
+    {
+        (void)pointer;
+        (void)size;
+        (void)alignment;
+
+        m_liveAllocations -= 1;
+    }
+
+    /*! \brief Release every allocation and start a new frame
+     *
+     * When several blocks were needed, they are merged into one so the next frame fits in a single block.
+     * Throws EscapedAllocation if an allocation is still alive, the check is made in every build
+     *
+     */
+    void ScratchArena::reset()
+    {
+        if(m_liveAllocations > 0)
+        {
+            ThrowException(EscapedAllocation);
+        }
+
+        if(m_block->previous)
+        {
+            std::size_t capacity = m_capacity;
+
+            releaseBlocks();
+            pushBlock(capacity);
+        }
+        else
+        {
+            m_cursor = reinterpret_cast<char*>(m_block + 1);
+        }
+
+        m_used             = 0;
+        m_liveAllocations  = 0;
+        m_frame           += 1;
+    }
+
+    /*! \brief Get the number of frames started by reset
+     *
+     * \return Return the current frame
+     *
+     */
+    Uint64 ScratchArena::getFrame() const
+    {
+        return m_frame;
+    }
+
+    /*! \brief Get the number of allocations not deallocated yet
+     *
+     * \return Return the number of allocations alive
+     *
+     */
+    std::size_t ScratchArena::getLiveAllocationCount() const
+    {
+        return m_liveAllocations;
+    }
+
+    /*! \brief Get the number of bytes allocated since the last reset
+     *
+     * \return Return the number of bytes used, alignment padding included
+     *
+     */
+    std::size_t ScratchArena::getUsedSize() const
+    {
+        return m_used;
+    }
+
+    /*! \brief Get the number of bytes held by the arena
+     *
+     * \return Return the total size of the blocks
+     *
+     */
+    std::size_t ScratchArena::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /*! \brief Allocate a new block and make it the current one
+     *
+     * \param size The number of bytes the block must hold
+     *
+     */
+    void ScratchArena::pushBlock(std::size_t size)
+    {
+        Block* block = static_cast<Block*>(::operator new(sizeof(Block) + size));
+
+        block->previous = m_block;
+        block->size     = size;
+
+        m_block     = block;
+        m_cursor    = reinterpret_cast<char*>(block + 1);
+        m_end       = m_cursor + size;
+        m_capacity += size;
+    }
+
+    /*! \brief Free every block
+     *
+     */
+    void ScratchArena::releaseBlocks()
+    {
+        while(m_block)
+        {
+            Block* previous = m_block->previous;
+
+            ::operator delete(m_block);
+
+            m_block = previous;
+        }
+
+        m_capacity = 0;
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef Bull_FloatFormatter_hpp
+#define Bull_FloatFormatter_hpp
+
+#include <cstddef>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct FloatFormatter
+        {
+            /*! \brief Write the shortest decimal representation which reads back as the same double
+             *
+             * \param value  The double to write
+             * \param buffer The buffer to write in, it must hold at least 25 characters
+             *
+             * \return Return the number of characters written
+             *
+             */
+            static std::size_t format(double value, char* buffer);
+
+            /*! \brief Write the shortest decimal representation which reads back as the same float
+             *
+             * \param value  The float to write
+             * \param buffer The buffer to write in, it must hold at least 25 characters
+             *
+             * \return Return the number of characters written
+             *
+             */
+            static std::size_t format(float value, char* buffer);
+        };
+    }
+}
+
+#endif // Bull_FloatFormatter_hpp
@@ -0,0 +1,37 @@
+#ifndef Bull_FloatParser_hpp
+#define Bull_FloatParser_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/ParseResult.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct FloatParser
+        {
+            /*! \brief Parse a double at the beginning of some characters
+             *
+             * \param data The characters to parse
+             * \param size The number of characters
+             *
+             * \return Return the result of the parsing, the value is correctly rounded
+             *
+             */
+            static ParseResult<double> parseDouble(const char* data, std::size_t size);
+
+            /*! \brief Parse a float at the beginning of some characters
+             *
+             * \param data The characters to parse
+             * \param size The number of characters
+             *
+             * \return Return the result of the parsing, the value is correctly rounded
+             *
+             */
+            static ParseResult<float> parseFloat(const char* data, std::size_t size);
+        };
+    }
+}
+
+#endif // Bull_FloatParser_hpp
@@ -0,0 +1,111 @@
+#include <cstring>
+
+#include <Bull/Core/Number/IntegerFormatter.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        namespace
+        {
+            /// Every pair of digits from 00 to 99, to write two digits per division
+            const char digitPairs[201] =
+                "00010203040506070809"
+                "10111213141516171819"
+                "20212223242526272829"
+                "30313233343536373839"
+                "40414243444546474849"
+                "50515253545556575859"
+                "60616263646566676869"
+                "70717273747576777879"
+                "80818283848586878889"
+                "90919293949596979899";
+        }
+
+        /*! \brief Count the decimal digits of an integer
+         *
+         * \param value The integer
+         *
+         * \return Return the number of digits needed to write the integer
+         *
+         */
+        std::size_t IntegerFormatter::countDigits(Uint64 value)
+        {
+            std::size_t digits = 1;
+
+            while(value >= 10000)
+            {
+                value  /= 10000;
+                digits += 4;
+            }
+
+            if(value >= 1000)
+            {
+                return digits + 3;
+            }
+
+            if(value >= 100)
+            {
+                return digits + 2;
+            }
+
+            return (value >= 10) ? digits + 1 : digits;
+        }
+
+        /*! \brief Write the decimal digits of an unsigned integer
+         *
+         * \param value  The integer to write
+         * \param buffer The buffer to write in, it must hold at least 20 characters
+         *
+         * \return Return the number of characters written
+         *
+         */
+        std::size_t IntegerFormatter::format(Uint64 value, char* buffer)
+        {
+            std::size_t size   = countDigits(value);
+            char*       cursor = buffer + size;
+
+            while(value >= 100)
+            {
+                Uint64 pair = value % 100;
+
+                value  /= 100;
+                cursor -= 2;
+
+                std::memcpy(cursor, &digitPairs[pair * 2], 2);
+            }
+
+            if(value >= 10)
+            {
+                std::memcpy(cursor - 2, &digitPairs[value * 2], 2);
+            }
+            else
+            {
+                cursor[-1] = static_cast<char>('0' + value);
+            }
+
+            return size;
+        }
+
+        /*! \brief Write a signed integer in decimal
+         *
+         * \param value  The integer to write
+         * \param buffer The buffer to write in, it must hold at least 20 characters
+         *
+         * \return Return the number of characters written
+         *
+         */
+        std::size_t IntegerFormatter::format(Int64 value, char* buffer)
+        {
+            if(value < 0)
+            {
+                buffer[0] = '-';
+
+                /// Negate in unsigned arithmetic so the smallest Int64 does not overflow
+                return format(Uint64(0) - static_cast<Uint64>(value), buffer + 1) + 1;
+            }
+
+            return format(static_cast<Uint64>(value), buffer);
+        }
+    }
+}
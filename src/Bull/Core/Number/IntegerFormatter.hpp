@@ -0,0 +1,46 @@
+#ifndef Bull_IntegerFormatter_hpp
+#define Bull_IntegerFormatter_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/Integer.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct IntegerFormatter
+        {
+            /*! \brief Count the decimal digits of an integer
+             *
+             * \param value The integer
+             *
+             * \return Return the number of digits needed to write the integer
+             *
+             */
+            static std::size_t countDigits(Uint64 value);
+
+            /*! \brief Write the decimal digits of an unsigned integer
+             *
+             * \param value  The integer to write
+             * \param buffer The buffer to write in, it must hold at least 20 characters
+             *
+             * \return Return the number of characters written
+             *
+             */
+            static std::size_t format(Uint64 value, char* buffer);
+
+            /*! \brief Write a signed integer in decimal
+             *
+             * \param value  The integer to write
+             * \param buffer The buffer to write in, it must hold at least 20 characters
+             *
+             * \return Return the number of characters written
+             *
+             */
+            static std::size_t format(Int64 value, char* buffer);
+        };
+    }
+}
+
+#endif // Bull_IntegerFormatter_hpp
@@ -0,0 +1,119 @@
+#include <Bull/Core/Number/IntegerParser.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        namespace
+        {
+            bool isDigit(char character)
+            {
+                return character >= '0' && character <= '9';
+            }
+
+            /// Parse a run of digits, consumed is 0 if there is none
+            ParseResult<Uint64> parseDigits(const char* data, std::size_t size)
+            {
+                const char* cursor = data;
+                const char* end    = data + size;
+
+                while(cursor < end && *cursor == '0')
+                {
+                    cursor++;
+                }
+
+                const char* significant = cursor;
+                Uint64 value = 0;
+
+                /// Up to 16 digits can be read by chunks before an overflow becomes possible
+                while(end - cursor >= 8 && cursor - significant <= 8)
+                {
+                    Uint64 chunk = IntegerParser::readEightCharacters(cursor);
+
+                    if(!IntegerParser::isEightDigits(chunk))
+                    {
+                        break;
+                    }
+
+                    value   = value * 100000000 + IntegerParser::parseEightDigits(chunk);
+                    cursor += 8;
+                }
+
+                while(cursor < end && isDigit(*cursor))
+                {
+                    Uint64 digit = static_cast<Uint64>(*cursor - '0');
+
+                    if(cursor - significant >= 19 && (cursor - significant >= 20 || value > (0xFFFFFFFFFFFFFFFFull - digit) / 10))
+                    {
+                        while(cursor < end && isDigit(*cursor))
+                        {
+                            cursor++;
+                        }
+
+                        return ParseResult<Uint64>(0, cursor - data, ParseResult<Uint64>::OutOfRange);
+                    }
+
+                    value = value * 10 + digit;
+                    cursor++;
+                }
+
+                return ParseResult<Uint64>(value, cursor - data);
+            }
+        }
+
+        /*! \brief Parse an unsigned integer at the beginning of some characters
+         *
+         * \param data The characters to parse
+         * \param size The number of characters
+         *
+         * \return Return the result of the parsing
+         *
+         */
+        ParseResult<Uint64> IntegerParser::parseUnsigned(const char* data, std::size_t size)
+        {
+            std::size_t start = (size > 0 && data[0] == '+') ? 1 : 0;
+            ParseResult<Uint64> result = parseDigits(data + start, size - start);
+
+            if(result.consumed == 0)
+            {
+                return ParseResult<Uint64>();
+            }
+
+            result.consumed += start;
+
+            return result;
+        }
+
+        /*! \brief Parse a signed integer at the beginning of some characters
+         *
+         * \param data The characters to parse
+         * \param size The number of characters
+         *
+         * \return Return the result of the parsing
+         *
+         */
+        ParseResult<Int64> IntegerParser::parseSigned(const char* data, std::size_t size)
+        {
+            bool isNegative   = size > 0 && data[0] == '-';
+            std::size_t start = (size > 0 && (data[0] == '-' || data[0] == '+')) ? 1 : 0;
+            ParseResult<Uint64> result = parseDigits(data + start, size - start);
+
+            if(result.consumed == 0)
+            {
+                return ParseResult<Int64>();
+            }
+
+            Uint64 limit = isNegative ? 0x8000000000000000ull : 0x7FFFFFFFFFFFFFFFull;
+
+            if(!result.isValid() || result.value > limit)
+            {
+                return ParseResult<Int64>(0, result.consumed + start, ParseResult<Int64>::OutOfRange);
+            }
+
+            /// Negate through value - 1 so the smallest Int64 does not overflow
+            Int64 value = isNegative ? -static_cast<Int64>(result.value - 1) - 1 : static_cast<Int64>(result.value);
+
+            return ParseResult<Int64>(value, result.consumed + start);
+        }
+    }
+}
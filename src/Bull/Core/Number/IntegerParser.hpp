@@ -0,0 +1,86 @@
+#ifndef Bull_IntegerParser_hpp
+#define Bull_IntegerParser_hpp
+
+#include <cstddef>
+#include <cstring>
+
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/ParseResult.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct IntegerParser
+        {
+            /*! \brief Read eight characters as a little endian integer
+             *
+             * \param data The characters to read
+             *
+             * \return Return the characters packed in an integer, the first one in the low byte
+             *
+             */
+            static Uint64 readEightCharacters(const char* data)
+            {
+                Uint64 chunk;
+                std::memcpy(&chunk, data, sizeof(chunk));
+
+                #if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                    chunk = __builtin_bswap64(chunk);
+                #endif
+
+                return chunk;
+            }
+
+            /*! \brief Check whether eight characters are all decimal digits
+             *
+             * \param chunk The characters read by readEightCharacters
+             *
+             * \return Return true if the eight characters are digits, false otherwise
+             *
+             */
+            static bool isEightDigits(Uint64 chunk)
+            {
+                return ((chunk & 0xF0F0F0F0F0F0F0F0ull) | (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+            }
+
+            /*! \brief Convert eight decimal digits to their value with a few multiplications
+             *
+             * \param chunk The digits read by readEightCharacters
+             *
+             * \return Return the value of the digits
+             *
+             */
+            static Uint32 parseEightDigits(Uint64 chunk)
+            {
+                chunk -= 0x3030303030303030ull;
+                chunk  = (chunk * 10) + (chunk >> 8);
+                chunk  = (((chunk & 0x000000FF000000FFull) * 0x000F424000000064ull) + (((chunk >> 16) & 0x000000FF000000FFull) * 0x0000271000000001ull)) >> 32;
+
+                return static_cast<Uint32>(chunk);
+            }
+
+            /*! \brief Parse an unsigned integer at the beginning of some characters
+             *
+             * \param data The characters to parse
+             * \param size The number of characters
+             *
+             * \return Return the result of the parsing
+             *
+             */
+            static ParseResult<Uint64> parseUnsigned(const char* data, std::size_t size);
+
+            /*! \brief Parse a signed integer at the beginning of some characters
+             *
+             * \param data The characters to parse
+             * \param size The number of characters
+             *
+             * \return Return the result of the parsing
+             *
+             */
+            static ParseResult<Int64> parseSigned(const char* data, std::size_t size);
+        };
+    }
+}
+
+#endif // Bull_IntegerParser_hpp
@@ -0,0 +1,65 @@
+#ifndef Bull_WideInteger_hpp
+#define Bull_WideInteger_hpp
+
+#include <Bull/Core/Integer.hpp>
+
+#if defined _MSC_VER && defined _M_X64
+    #include <intrin.h>
+#endif
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct WideInteger
+        {
+            /*! \brief Compute the 128 bits product of two integers
+             *
+             * \param left  The first factor
+             * \param right The second factor
+             * \param low   The low 64 bits of the product
+             * \param high  The high 64 bits of the product
+             *
+             */
+            static void multiply(Uint64 left, Uint64 right, Uint64& low, Uint64& high)
+            {
+                #if defined __SIZEOF_INT128__
+                    unsigned __int128 product = static_cast<unsigned __int128>(left) * right;
+
+                    low  = static_cast<Uint64>(product);
+                    high = static_cast<Uint64>(product >> 64);
+                #elif defined _MSC_VER && defined _M_X64
+                    low = _umul128(left, right, &high);
+                #else
+                    Uint64 ll = static_cast<Uint32>(left) * static_cast<Uint64>(static_cast<Uint32>(right));
+                    Uint64 lh = static_cast<Uint32>(left) * (right >> 32);
+                    Uint64 hl = (left >> 32) * static_cast<Uint32>(right);
+                    Uint64 hh = (left >> 32) * (right >> 32);
+                    Uint64 middle = (ll >> 32) + static_cast<Uint32>(lh) + static_cast<Uint32>(hl);
+
+                    low  = (middle << 32) | static_cast<Uint32>(ll);
+                    high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+                #endif
+            }
+
+            /*! \brief Compute the high 64 bits of the product of two integers
+             *
+             * \param left  The first factor
+             * \param right The second factor
+             *
+             * \return Return the high 64 bits of the product
+             *
+             */
+            static Uint64 multiplyHigh(Uint64 left, Uint64 right)
+            {
+                Uint64 low, high;
+
+                multiply(left, right, low, high);
+
+                return high;
+            }
+        };
+    }
+}
+
+#endif // Bull_WideInteger_hpp
@@ -0,0 +1,74 @@
+#include <Bull/Core/Simd/CpuFeatures.hpp>
+
+#if defined BULL_SIMD_X86 && defined _MSC_VER
+    #include <intrin.h>
+#endif
+
+namespace Bull
+{
+    namespace prv
+    {
+        /*! \brief Check whether the CPU supports SSE2 instructions
+         *
+         * \return Return true if SSE2 instructions can be used, false otherwise
+         *
+         */
+        bool CpuFeatures::hasSse2()
+        {
+            #if defined __x86_64__ || defined _M_X64
+                return true;
+            #elif defined BULL_SIMD_X86 && defined _MSC_VER
+                int info[4];
+                __cpuid(info, 1);
+
+                return (info[3] & (1 << 26)) != 0;
+            #elif defined BULL_SIMD_X86
+                return __builtin_cpu_supports("sse2");
+            #else
+                return false;
+            #endif
+        }
+
+        /*! \brief Check whether the CPU supports SSSE3 instructions
+         *
+         * \return Return true if SSSE3 instructions can be used, false otherwise
+         *
+         */
+        bool CpuFeatures::hasSsse3()
+        {
+            #if defined BULL_SIMD_X86 && defined _MSC_VER
+                int info[4];
+                __cpuid(info, 1);
+
+                return (info[2] & (1 << 9)) != 0;
+            #elif defined BULL_SIMD_X86
+                return __builtin_cpu_supports("ssse3");
+            #else
+                return false;
+            #endif
+        }
+
+        /*! \brief Check whether the CPU and the OS support AVX2 instructions
+         *
+         * \return Return true if AVX2 instructions can be used, false otherwise
+         *
+         */
+        bool CpuFeatures::hasAvx2()
+        {
+            #if defined BULL_SIMD_X86 && defined _MSC_VER
+                int info[4];
+                __cpuid(info, 1);
+
+                bool osSaveYmm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6;
+
+                __cpuidex(info, 7, 0);
+
+                return osSaveYmm && (info[1] & (1 << 5)) != 0;
+            #elif defined BULL_SIMD_X86
+                return __builtin_cpu_supports("avx2");
+            #else
+                return false;
+            #endif
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef Bull_CpuFeatures_hpp
+#define Bull_CpuFeatures_hpp
+
+#include <Bull/Core/System/Config.hpp>
+
+#if defined __x86_64__ || defined _M_X64 || defined __i386__ || defined _M_IX86
+    #define BULL_SIMD_X86
+#endif
+
+/// Kernels are compiled for a given instruction set and only called when the CPU supports it,
+/// GCC and Clang need the target of each of these functions, MSVC allows intrinsics everywhere
+#if defined BULL_SIMD_X86 && (defined __GNUC__ || defined __clang__)
+    #define BULL_TARGET_SSE2 __attribute__((target("sse2")))
+    #define BULL_TARGET_SSSE3 __attribute__((target("ssse3")))
+    #define BULL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define BULL_TARGET_SSE2
+    #define BULL_TARGET_SSSE3
+    #define BULL_TARGET_AVX2
+#endif
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct CpuFeatures
+        {
+            /*! \brief Check whether the CPU supports SSE2 instructions
+             *
+             * \return Return true if SSE2 instructions can be used, false otherwise
+             *
+             */
+            static bool hasSse2();
+
+            /*! \brief Check whether the CPU supports SSSE3 instructions
+             *
+             * \return Return true if SSSE3 instructions can be used, false otherwise
+             *
+             */
+            static bool hasSsse3();
+
+            /*! \brief Check whether the CPU and the OS support AVX2 instructions
+             *
+             * \return Return true if AVX2 instructions can be used, false otherwise
+             *
+             */
+            static bool hasAvx2();
+        };
+    }
+}
+
+#endif // Bull_CpuFeatures_hpp
@@ -0,0 +1,617 @@
+#include <algorithm>
+
+#include <Bull/Core/Simd/CpuFeatures.hpp>
+#include <Bull/Core/Simd/EncodingKernels.hpp>
+
+#if defined BULL_SIMD_X86
+    #include <immintrin.h>
+#endif
+
+namespace Bull
+{
+    namespace prv
+    {
+        namespace
+        {
+            /// Every kernel exists in a scalar version and, on x86, in faster versions (SSSE3 and AVX2 for Base64, SSE2 and AVX2 for hexadecimal).
+            /// A kernel handles as many complete blocks as it can and returns how far it went, the caller deals with the rest
+            struct KernelTable
+            {
+                std::size_t (*encodeBase64)(const Uint8* data, std::size_t size, char* text);
+                std::size_t (*decodeBase64)(const char* text, std::size_t size, Uint8* data);
+                std::size_t (*encodeHex)(const Uint8* data, std::size_t size, char* text);
+                std::size_t (*decodeHex)(const char* text, std::size_t size, Uint8* data);
+            };
+
+            const char Base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            const char HexAlphabet[]    = "0123456789abcdef";
+
+            const Uint8 Invalid = 0xFF;
+
+            const Uint8 Base64Values[256] = {
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+                0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+                0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+                0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+            };
+
+            const Uint8 HexValues[256] = {
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+            };
+
+            /// Encode the complete groups of 3 bytes
+            std::size_t encodeBase64Scalar(const Uint8* data, std::size_t size, char* text)
+            {
+                std::size_t i = 0;
+
+                for(; size - i >= 3; i += 3, text += 4)
+                {
+                    Uint32 group = (static_cast<Uint32>(data[i]) << 16) | (static_cast<Uint32>(data[i + 1]) << 8) | data[i + 2];
+
+                    text[0] = Base64Alphabet[(group >> 18) & 0x3F];
+                    text[1] = Base64Alphabet[(group >> 12) & 0x3F];
+                    text[2] = Base64Alphabet[(group >> 6) & 0x3F];
+                    text[3] = Base64Alphabet[group & 0x3F];
+                }
+
+                return i;
+            }
+
+            /// Decode groups of 4 characters without padding, stop at the first group with an invalid character
+            std::size_t decodeBase64Scalar(const char* text, std::size_t size, Uint8* data)
+            {
+                std::size_t i = 0;
+
+                for(; size - i >= 4; i += 4, data += 3)
+                {
+                    Uint32 a = Base64Values[static_cast<Uint8>(text[i])];
+                    Uint32 b = Base64Values[static_cast<Uint8>(text[i + 1])];
+                    Uint32 c = Base64Values[static_cast<Uint8>(text[i + 2])];
+                    Uint32 d = Base64Values[static_cast<Uint8>(text[i + 3])];
+
+                    if((a | b | c | d) > 0x3F)
+                    {
+                        break;
+                    }
+
+                    Uint32 group = (a << 18) | (b << 12) | (c << 6) | d;
+
+                    data[0] = static_cast<Uint8>(group >> 16);
+                    data[1] = static_cast<Uint8>(group >> 8);
+                    data[2] = static_cast<Uint8>(group);
+                }
+
+                return i;
+            }
+
+            std::size_t encodeHexScalar(const Uint8* data, std::size_t size, char* text)
+            {
+                for(std::size_t i = 0; i < size; i++)
+                {
+                    text[2 * i]     = HexAlphabet[data[i] >> 4];
+                    text[2 * i + 1] = HexAlphabet[data[i] & 0x0F];
+                }
+
+                return size;
+            }
+
+            /// Decode pairs of characters, stop at the first pair with an invalid character
+            std::size_t decodeHexScalar(const char* text, std::size_t size, Uint8* data)
+            {
+                std::size_t i = 0;
+
+                for(; size - i >= 2; i += 2)
+                {
+                    Uint8 high = HexValues[static_cast<Uint8>(text[i])];
+                    Uint8 low  = HexValues[static_cast<Uint8>(text[i + 1])];
+
+                    if((high | low) > 0x0F)
+                    {
+                        break;
+                    }
+
+                    data[i / 2] = static_cast<Uint8>((high << 4) | low);
+                }
+
+                return i;
+            }
+
+        #if defined BULL_SIMD_X86
+
+            /// Base64 kernels follow "Faster Base64 Encoding and Decoding Using AVX2 Instructions" (Muła, Kurz, Lemire).
+            /// Each group of 3 bytes is spread over 4 bytes, the four 6-bit indices are moved into place with one multiplication,
+            /// then turned into characters with a 16 entries lookup indexed by the range of the index
+            BULL_TARGET_SSSE3 __m128i splitBase64Ssse3(__m128i input)
+            {
+                input = _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+                __m128i high = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+                __m128i low  = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+
+                return _mm_or_si128(high, low);
+            }
+
+            BULL_TARGET_SSSE3 __m128i translateBase64Ssse3(__m128i indices)
+            {
+                /// 0 for [26, 51], 1 to 12 for [52, 63], 13 for [0, 25]
+                __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+                range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+
+                __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+                return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+            }
+
+            BULL_TARGET_SSSE3 std::size_t encodeBase64Ssse3(const Uint8* data, std::size_t size, char* text)
+            {
+                std::size_t i = 0;
+
+                /// 16 bytes are read to encode 12 of them
+                for(; size - i >= 16; i += 12, text += 16)
+                {
+                    __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(text), translateBase64Ssse3(splitBase64Ssse3(input)));
+                }
+
+                return i + encodeBase64Scalar(data + i, size - i, text);
+            }
+
+            BULL_TARGET_SSSE3 std::size_t decodeBase64Ssse3(const char* text, std::size_t size, Uint8* data)
+            {
+                const __m128i lowLookup    = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+                const __m128i highLookup   = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+                const __m128i offsetLookup = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+                const __m128i slash        = _mm_set1_epi8('/');
+                std::size_t i = 0;
+
+                /// 16 bytes are written to store 12 of them, the 8 characters left behind give room for the 4 extra bytes
+                for(; size - i >= 24; i += 16, data += 12)
+                {
+                    __m128i input      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+                    __m128i highNibble = _mm_and_si128(_mm_srli_epi32(input, 4), slash);
+                    __m128i lowNibble  = _mm_and_si128(input, slash);
+
+                    /// A character is valid when the classes of its two nibbles do not share any bit
+                    __m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lowLookup, lowNibble), _mm_shuffle_epi8(highLookup, highNibble));
+
+                    if(_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) != 0xFFFF)
+                    {
+                        break;
+                    }
+
+                    __m128i offset = _mm_shuffle_epi8(offsetLookup, _mm_add_epi8(_mm_cmpeq_epi8(input, slash), highNibble));
+                    __m128i values = _mm_add_epi8(input, offset);
+
+                    values = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+                    values = _mm_madd_epi16(values, _mm_set1_epi32(0x00011000));
+                    values = _mm_shuffle_epi8(values, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), values);
+                }
+
+                return i + decodeBase64Scalar(text + i, size - i, data);
+            }
+
+            BULL_TARGET_SSE2 __m128i toHexDigitsSse2(__m128i nibbles)
+            {
+                __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+
+                return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+            }
+
+            BULL_TARGET_SSE2 std::size_t encodeHexSse2(const Uint8* data, std::size_t size, char* text)
+            {
+                const __m128i mask = _mm_set1_epi8(0x0F);
+                std::size_t i = 0;
+
+                for(; size - i >= 16; i += 16)
+                {
+                    __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                    __m128i high  = toHexDigitsSse2(_mm_and_si128(_mm_srli_epi16(input, 4), mask));
+                    __m128i low   = toHexDigitsSse2(_mm_and_si128(input, mask));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(text + 2 * i), _mm_unpacklo_epi8(high, low));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(text + 2 * i + 16), _mm_unpackhi_epi8(high, low));
+                }
+
+                return i + encodeHexScalar(data + i, size - i, text + 2 * i);
+            }
+
+            /// Get the values of 16 hexadecimal characters, 0xFF for the characters which are not digits
+            BULL_TARGET_SSE2 __m128i fromHexDigitsSse2(__m128i input)
+            {
+                __m128i digit    = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+                __m128i letter   = _mm_sub_epi8(_mm_or_si128(input, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+                __m128i isDigit  = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+                __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+                __m128i invalid  = _mm_andnot_si128(_mm_or_si128(isDigit, isLetter), _mm_set1_epi8(-1));
+
+                return _mm_or_si128(_mm_or_si128(_mm_and_si128(isDigit, digit), _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10)))), invalid);
+            }
+
+            /// Merge the pairs of nibbles, each 16 bits word holds a pair with the high nibble in its low byte
+            BULL_TARGET_SSE2 __m128i mergeNibblesSse2(__m128i values)
+            {
+                return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00FF)), 4), _mm_srli_epi16(values, 8));
+            }
+
+            BULL_TARGET_SSE2 std::size_t decodeHexSse2(const char* text, std::size_t size, Uint8* data)
+            {
+                std::size_t i = 0;
+
+                for(; size - i >= 32; i += 32)
+                {
+                    __m128i first  = fromHexDigitsSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i)));
+                    __m128i second = fromHexDigitsSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + 16)));
+
+                    if(_mm_movemask_epi8(_mm_or_si128(first, second)) != 0)
+                    {
+                        break;
+                    }
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i / 2), _mm_packus_epi16(mergeNibblesSse2(first), mergeNibblesSse2(second)));
+                }
+
+                return i + decodeHexScalar(text + i, size - i, data + i / 2);
+            }
+
+            BULL_TARGET_AVX2 __m256i splitBase64Avx2(__m256i input)
+            {
+                const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                         1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+                input = _mm256_shuffle_epi8(input, shuffle);
+
+                __m256i high = _mm256_mulhi_epu16(_mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+                __m256i low  = _mm256_mullo_epi16(_mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+
+                return _mm256_or_si256(high, low);
+            }
+
+            BULL_TARGET_AVX2 __m256i translateBase64Avx2(__m256i indices)
+            {
+                __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+                range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+
+                __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                                   'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                   '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+                return _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+            }
+
+            BULL_TARGET_AVX2 std::size_t encodeBase64Avx2(const Uint8* data, std::size_t size, char* text)
+            {
+                std::size_t i = 0;
+
+                /// Each lane encodes 12 bytes, 28 bytes are read to encode 24 of them
+                for(; size - i >= 28; i += 24, text += 32)
+                {
+                    __m128i low   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                    __m128i high  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 12));
+                    __m256i input = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(text), translateBase64Avx2(splitBase64Avx2(input)));
+                }
+
+                /// Clear the upper halves of the registers, the tail would otherwise pay an AVX to SSE transition
+                _mm256_zeroupper();
+
+                return i + encodeBase64Scalar(data + i, size - i, text);
+            }
+
+            BULL_TARGET_AVX2 std::size_t decodeBase64Avx2(const char* text, std::size_t size, Uint8* data)
+            {
+                const __m256i lowLookup    = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                                              0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+                const __m256i highLookup   = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                                              0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+                const __m256i offsetLookup = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                              0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+                const __m256i pack         = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                              2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+                const __m256i slash        = _mm256_set1_epi8('/');
+                std::size_t i = 0;
+
+                /// 32 bytes are written to store 24 of them, the 16 characters left behind give room for the 8 extra bytes
+                for(; size - i >= 48; i += 32, data += 24)
+                {
+                    __m256i input      = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+                    __m256i highNibble = _mm256_and_si256(_mm256_srli_epi32(input, 4), slash);
+                    __m256i lowNibble  = _mm256_and_si256(input, slash);
+
+                    if(!_mm256_testz_si256(_mm256_shuffle_epi8(lowLookup, lowNibble), _mm256_shuffle_epi8(highLookup, highNibble)))
+                    {
+                        break;
+                    }
+
+                    __m256i offset = _mm256_shuffle_epi8(offsetLookup, _mm256_add_epi8(_mm256_cmpeq_epi8(input, slash), highNibble));
+                    __m256i values = _mm256_add_epi8(input, offset);
+
+                    values = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+                    values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+                    values = _mm256_shuffle_epi8(values, pack);
+                    values = _mm256_permutevar8x32_epi32(values, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), values);
+                }
+
+                _mm256_zeroupper();
+
+                return i + decodeBase64Scalar(text + i, size - i, data);
+            }
+
+            BULL_TARGET_AVX2 __m256i toHexDigitsAvx2(__m256i nibbles)
+            {
+                __m256i letters = _mm256_and_si256(_mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9)), _mm256_set1_epi8('a' - '0' - 10));
+
+                return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')), letters);
+            }
+
+            BULL_TARGET_AVX2 std::size_t encodeHexAvx2(const Uint8* data, std::size_t size, char* text)
+            {
+                const __m256i mask = _mm256_set1_epi8(0x0F);
+                std::size_t i = 0;
+
+                for(; size - i >= 32; i += 32)
+                {
+                    __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                    __m256i high  = toHexDigitsAvx2(_mm256_and_si256(_mm256_srli_epi16(input, 4), mask));
+                    __m256i low   = toHexDigitsAvx2(_mm256_and_si256(input, mask));
+
+                    /// Unpacking works inside each lane, the halves are put back in order afterwards
+                    __m256i first  = _mm256_unpacklo_epi8(high, low);
+                    __m256i second = _mm256_unpackhi_epi8(high, low);
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(text + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(text + 2 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+                }
+
+                _mm256_zeroupper();
+
+                return i + encodeHexScalar(data + i, size - i, text + 2 * i);
+            }
+
+            BULL_TARGET_AVX2 __m256i fromHexDigitsAvx2(__m256i input)
+            {
+                __m256i digit    = _mm256_sub_epi8(input, _mm256_set1_epi8('0'));
+                __m256i letter   = _mm256_sub_epi8(_mm256_or_si256(input, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+                __m256i isDigit  = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+                __m256i isLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+                __m256i invalid  = _mm256_andnot_si256(_mm256_or_si256(isDigit, isLetter), _mm256_set1_epi8(-1));
+
+                return _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(isDigit, digit), _mm256_and_si256(isLetter, _mm256_add_epi8(letter, _mm256_set1_epi8(10)))), invalid);
+            }
+
+            BULL_TARGET_AVX2 __m256i mergeNibblesAvx2(__m256i values)
+            {
+                return _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(values, _mm256_set1_epi16(0x00FF)), 4), _mm256_srli_epi16(values, 8));
+            }
+
+            BULL_TARGET_AVX2 std::size_t decodeHexAvx2(const char* text, std::size_t size, Uint8* data)
+            {
+                std::size_t i = 0;
+
+                for(; size - i >= 64; i += 64)
+                {
+                    __m256i first  = fromHexDigitsAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i)));
+                    __m256i second = fromHexDigitsAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i + 32)));
+
+                    if(_mm256_movemask_epi8(_mm256_or_si256(first, second)) != 0)
+                    {
+                        break;
+                    }
+
+                    /// Packing works inside each lane too
+                    __m256i bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(mergeNibblesAvx2(first), mergeNibblesAvx2(second)), 0xD8);
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i / 2), bytes);
+                }
+
+                _mm256_zeroupper();
+
+                return i + decodeHexScalar(text + i, size - i, data + i / 2);
+            }
+
+        #endif // defined BULL_SIMD_X86
+
+            KernelTable selectKernels()
+            {
+                #if defined BULL_SIMD_X86
+                    if(CpuFeatures::hasAvx2())
+                    {
+                        return KernelTable{&encodeBase64Avx2, &decodeBase64Avx2, &encodeHexAvx2, &decodeHexAvx2};
+                    }
+
+                    if(CpuFeatures::hasSsse3())
+                    {
+                        return KernelTable{&encodeBase64Ssse3, &decodeBase64Ssse3, &encodeHexSse2, &decodeHexSse2};
+                    }
+
+                    if(CpuFeatures::hasSse2())
+                    {
+                        return KernelTable{&encodeBase64Scalar, &decodeBase64Scalar, &encodeHexSse2, &decodeHexSse2};
+                    }
+                #endif
+
+                return KernelTable{&encodeBase64Scalar, &decodeBase64Scalar, &encodeHexScalar, &decodeHexScalar};
+            }
+
+            const KernelTable& getKernels()
+            {
+                static const KernelTable kernels = selectKernels();
+
+                return kernels;
+            }
+
+            /// Find the first character which is not in a table, in a group known to hold one
+            std::size_t findInvalid(const char* text, std::size_t size, const Uint8* values)
+            {
+                std::size_t i = 0;
+
+                while(i < size && values[static_cast<Uint8>(text[i])] != Invalid)
+                {
+                    i++;
+                }
+
+                return i;
+            }
+        }
+
+        /*! \brief Encode bytes in Base64 with padding
+         *
+         * \param data The bytes to encode
+         * \param size The number of bytes
+         * \param text The characters to fill, there must be room for 4 characters per started group of 3 bytes
+         *
+         */
+        void EncodingKernels::toBase64(const Uint8* data, std::size_t size, char* text)
+        {
+            std::size_t encoded = getKernels().encodeBase64(data, size, text);
+
+            text += encoded / 3 * 4;
+
+            if(size - encoded == 1)
+            {
+                text[0] = Base64Alphabet[data[encoded] >> 2];
+                text[1] = Base64Alphabet[(data[encoded] & 0x03) << 4];
+                text[2] = '=';
+                text[3] = '=';
+            }
+            else if(size - encoded == 2)
+            {
+                text[0] = Base64Alphabet[data[encoded] >> 2];
+                text[1] = Base64Alphabet[((data[encoded] & 0x03) << 4) | (data[encoded + 1] >> 4)];
+                text[2] = Base64Alphabet[(data[encoded + 1] & 0x0F) << 2];
+                text[3] = '=';
+            }
+        }
+
+        /*! \brief Decode Base64 characters
+         *
+         * The characters are split in groups of 4, only the last one can end with padding
+         *
+         * \param text The characters to decode
+         * \param size The number of characters
+         * \param data The bytes to fill, there must be room for 3 bytes per group of 4 characters
+         *
+         * \return Return the number of bytes decoded, or the index of the first character which can not be decoded
+         *
+         */
+        ParseResult<std::size_t> EncodingKernels::fromBase64(const char* text, std::size_t size, Uint8* data)
+        {
+            /// The last group is decoded apart since it may hold padding, or be incomplete
+            std::size_t body    = (size % 4 == 0 && size > 0) ? size - 4 : size / 4 * 4;
+            std::size_t decoded = getKernels().decodeBase64(text, body, data);
+
+            if(decoded < body)
+            {
+                return ParseResult<std::size_t>(decoded / 4 * 3, decoded + findInvalid(text + decoded, 4, Base64Values), ParseResult<std::size_t>::InvalidCharacter);
+            }
+
+            const char* last    = text + body;
+            std::size_t written = body / 4 * 3;
+            std::size_t rest    = size - body;
+
+            if(rest == 0)
+            {
+                return ParseResult<std::size_t>(written, size);
+            }
+
+            /// Up to two characters of padding, never before the third character of the group
+            std::size_t characters = rest;
+
+            if(rest == 4 && last[3] == '=')
+            {
+                characters = last[2] == '=' ? 2 : 3;
+            }
+
+            std::size_t invalid = findInvalid(last, characters, Base64Values);
+
+            /// An incomplete group is reported at its first invalid character, or at the end of the text
+            if(invalid < characters || rest < 4)
+            {
+                return ParseResult<std::size_t>(written, body + invalid, ParseResult<std::size_t>::InvalidCharacter);
+            }
+
+            Uint32 group = 0;
+
+            for(std::size_t i = 0; i < 4; i++)
+            {
+                group = (group << 6) | (i < characters ? Base64Values[static_cast<Uint8>(last[i])] : 0);
+            }
+
+            for(std::size_t i = 0; i < characters - 1; i++)
+            {
+                data[written++] = static_cast<Uint8>(group >> (16 - 8 * i));
+            }
+
+            return ParseResult<std::size_t>(written, size);
+        }
+
+        /*! \brief Encode bytes in lowercase hexadecimal
+         *
+         * \param data The bytes to encode
+         * \param size The number of bytes
+         * \param text The characters to fill, there must be room for 2 characters per byte
+         *
+         */
+        void EncodingKernels::toHex(const Uint8* data, std::size_t size, char* text)
+        {
+            getKernels().encodeHex(data, size, text);
+        }
+
+        /*! \brief Decode hexadecimal characters in any case
+         *
+         * \param text The characters to decode
+         * \param size The number of characters
+         * \param data The bytes to fill, there must be room for 1 byte per pair of characters
+         *
+         * \return Return the number of bytes decoded, or the index of the first character which can not be decoded
+         *
+         */
+        ParseResult<std::size_t> EncodingKernels::fromHex(const char* text, std::size_t size, Uint8* data)
+        {
+            std::size_t decoded = getKernels().decodeHex(text, size, data);
+
+            if(decoded < size)
+            {
+                std::size_t invalid = decoded + findInvalid(text + decoded, std::min<std::size_t>(size - decoded, 2), HexValues);
+
+                return ParseResult<std::size_t>(decoded / 2, invalid, ParseResult<std::size_t>::InvalidCharacter);
+            }
+
+            return ParseResult<std::size_t>(decoded / 2, size);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef Bull_EncodingKernels_hpp
+#define Bull_EncodingKernels_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/ParseResult.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct EncodingKernels
+        {
+            /*! \brief Encode bytes in Base64 with padding
+             *
+             * \param data The bytes to encode
+             * \param size The number of bytes
+             * \param text The characters to fill, there must be room for 4 characters per started group of 3 bytes
+             *
+             */
+            static void toBase64(const Uint8* data, std::size_t size, char* text);
+
+            /*! \brief Decode Base64 characters
+             *
+             * The characters are split in groups of 4, only the last one can end with padding
+             *
+             * \param text The characters to decode
+             * \param size The number of characters
+             * \param data The bytes to fill, there must be room for 3 bytes per group of 4 characters
+             *
+             * \return Return the number of bytes decoded, or the index of the first character which can not be decoded
+             *
+             */
+            static ParseResult<std::size_t> fromBase64(const char* text, std::size_t size, Uint8* data);
+
+            /*! \brief Encode bytes in lowercase hexadecimal
+             *
+             * \param data The bytes to encode
+             * \param size The number of bytes
+             * \param text The characters to fill, there must be room for 2 characters per byte
+             *
+             */
+            static void toHex(const Uint8* data, std::size_t size, char* text);
+
+            /*! \brief Decode hexadecimal characters in any case
+             *
+             * \param text The characters to decode
+             * \param size The number of characters
+             * \param data The bytes to fill, there must be room for 1 byte per pair of characters
+             *
+             * \return Return the number of bytes decoded, or the index of the first character which can not be decoded
+             *
+             */
+            static ParseResult<std::size_t> fromHex(const char* text, std::size_t size, Uint8* data);
+        };
+    }
+}
+
+#endif // Bull_EncodingKernels_hpp
@@ -0,0 +1,631 @@
+#include <algorithm>
+#include <cstring>
+
+#include <Bull/Core/Integer.hpp>
+#include <Bull/Core/Simd/CpuFeatures.hpp>
+#include <Bull/Core/Simd/StringKernels.hpp>
+
+#if defined BULL_SIMD_X86
+    #include <immintrin.h>
+#endif
+
+#if defined _MSC_VER
+    #include <intrin.h>
+#endif
+
+namespace Bull
+{
+    namespace prv
+    {
+        namespace
+        {
+            /// Every kernel exists in a scalar version and, on x86, in SSE2 and AVX2 versions.
+            /// The best version supported by the CPU is selected the first time a kernel is used.
+            struct KernelTable
+            {
+                std::size_t (*count)(const char* data, std::size_t size, char first, char second);
+                const char* (*find)(const char* data, std::size_t size, char character);
+                const char* (*findLast)(const char* data, std::size_t size, char character);
+                const char* (*search)(const char* data, std::size_t size, const char* needle, std::size_t needleSize);
+                void (*flipCase)(char* data, std::size_t size, char first, char last);
+                int (*compareIgnoreCase)(const char* left, const char* right, std::size_t size);
+            };
+
+            unsigned int countTrailingZeros(Uint32 mask)
+            {
+                #if defined _MSC_VER
+                    unsigned long index;
+                    _BitScanForward(&index, mask);
+
+                    return index;
+                #else
+                    return __builtin_ctz(mask);
+                #endif
+            }
+
+            unsigned int findHighestBit(Uint32 mask)
+            {
+                #if defined _MSC_VER
+                    unsigned long index;
+                    _BitScanReverse(&index, mask);
+
+                    return index;
+                #else
+                    return 31 - __builtin_clz(mask);
+                #endif
+            }
+
+            std::size_t countScalar(const char* data, std::size_t size, char first, char second)
+            {
+                std::size_t count = 0;
+
+                for(std::size_t i = 0; i < size; i++)
+                {
+                    if(data[i] == first || data[i] == second)
+                    {
+                        count += 1;
+                    }
+                }
+
+                return count;
+            }
+
+            const char* findScalar(const char* data, std::size_t size, char character)
+            {
+                return static_cast<const char*>(std::memchr(data, character, size));
+            }
+
+            const char* findLastScalar(const char* data, std::size_t size, char character)
+            {
+                while(size > 0)
+                {
+                    size -= 1;
+
+                    if(data[size] == character)
+                    {
+                        return data + size;
+                    }
+                }
+
+                return nullptr;
+            }
+
+            /// Jump between occurrences of the first character and compare the rest
+            const char* searchScalar(const char* data, std::size_t size, const char* needle, std::size_t needleSize)
+            {
+                if(needleSize > size)
+                {
+                    return nullptr;
+                }
+
+                const char* end = data + size - needleSize + 1;
+
+                while(data < end)
+                {
+                    data = static_cast<const char*>(std::memchr(data, needle[0], end - data));
+
+                    if(!data)
+                    {
+                        return nullptr;
+                    }
+
+                    if(std::memcmp(data + 1, needle + 1, needleSize - 1) == 0)
+                    {
+                        return data;
+                    }
+
+                    data += 1;
+                }
+
+                return nullptr;
+            }
+
+            /// Flip the case bit of characters in [first, last], both bounds must be ASCII letters of the same case
+            void flipCaseScalar(char* data, std::size_t size, char first, char last)
+            {
+                for(std::size_t i = 0; i < size; i++)
+                {
+                    if(data[i] >= first && data[i] <= last)
+                    {
+                        data[i] ^= 0x20;
+                    }
+                }
+            }
+
+            Uint8 foldCase(char character)
+            {
+                return static_cast<Uint8>((character >= 'A' && character <= 'Z') ? character | 0x20 : character);
+            }
+
+            int compareIgnoreCaseScalar(const char* left, const char* right, std::size_t size)
+            {
+                for(std::size_t i = 0; i < size; i++)
+                {
+                    Uint8 l = foldCase(left[i]);
+                    Uint8 r = foldCase(right[i]);
+
+                    if(l != r)
+                    {
+                        return (l < r) ? -1 : 1;
+                    }
+                }
+
+                return 0;
+            }
+
+        #if defined BULL_SIMD_X86
+
+            BULL_TARGET_SSE2 std::size_t countSse2(const char* data, std::size_t size, char first, char second)
+            {
+                const __m128i firstValue  = _mm_set1_epi8(first);
+                const __m128i secondValue = _mm_set1_epi8(second);
+                const __m128i zero        = _mm_setzero_si128();
+                std::size_t count = 0;
+                std::size_t i     = 0;
+
+                while(size - i >= 16)
+                {
+                    /// Each byte of the accumulator counts up to 255 matches before it is flushed
+                    std::size_t blocks = std::min<std::size_t>((size - i) / 16, 255);
+                    __m128i accumulator = zero;
+
+                    for(std::size_t block = 0; block < blocks; block++, i += 16)
+                    {
+                        __m128i chunk   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                        __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(chunk, firstValue), _mm_cmpeq_epi8(chunk, secondValue));
+
+                        accumulator = _mm_sub_epi8(accumulator, matches);
+                    }
+
+                    __m128i sums = _mm_sad_epu8(accumulator, zero);
+
+                    count += _mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4);
+                }
+
+                return count + countScalar(data + i, size - i, first, second);
+            }
+
+            BULL_TARGET_SSE2 const char* findSse2(const char* data, std::size_t size, char character)
+            {
+                const __m128i value = _mm_set1_epi8(character);
+                std::size_t i = 0;
+
+                for(; size - i >= 16; i += 16)
+                {
+                    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                    Uint32  mask  = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, value));
+
+                    if(mask)
+                    {
+                        return data + i + countTrailingZeros(mask);
+                    }
+                }
+
+                return findScalar(data + i, size - i, character);
+            }
+
+            BULL_TARGET_SSE2 const char* findLastSse2(const char* data, std::size_t size, char character)
+            {
+                const __m128i value = _mm_set1_epi8(character);
+
+                for(; size >= 16; size -= 16)
+                {
+                    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + size - 16));
+                    Uint32  mask  = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, value));
+
+                    if(mask)
+                    {
+                        return data + size - 16 + findHighestBit(mask);
+                    }
+                }
+
+                return findLastScalar(data, size, character);
+            }
+
+            /// Compare blocks of candidates on their first and last characters, then check the middle of the ones matching both
+            BULL_TARGET_SSE2 const char* searchSse2(const char* data, std::size_t size, const char* needle, std::size_t needleSize)
+            {
+                const __m128i first = _mm_set1_epi8(needle[0]);
+                const __m128i last  = _mm_set1_epi8(needle[needleSize - 1]);
+                std::size_t i = 0;
+
+                for(; size - i >= needleSize - 1 + 16; i += 16)
+                {
+                    __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                    __m128i blockLast  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + needleSize - 1));
+                    Uint32  mask       = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last)));
+
+                    while(mask)
+                    {
+                        std::size_t candidate = i + countTrailingZeros(mask);
+
+                        if(std::memcmp(data + candidate + 1, needle + 1, needleSize - 2) == 0)
+                        {
+                            return data + candidate;
+                        }
+
+                        mask &= mask - 1;
+                    }
+                }
+
+                return searchScalar(data + i, size - i, needle, needleSize);
+            }
+
+            BULL_TARGET_SSE2 void flipCaseSse2(char* data, std::size_t size, char first, char last)
+            {
+                const __m128i lowerBound = _mm_set1_epi8(first - 1);
+                const __m128i upperBound = _mm_set1_epi8(last + 1);
+                const __m128i caseBit    = _mm_set1_epi8(0x20);
+                std::size_t i = 0;
+
+                for(; size - i >= 16; i += 16)
+                {
+                    __m128i chunk   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                    __m128i inRange = _mm_and_si128(_mm_cmpgt_epi8(chunk, lowerBound), _mm_cmpgt_epi8(upperBound, chunk));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_xor_si128(chunk, _mm_and_si128(inRange, caseBit)));
+                }
+
+                flipCaseScalar(data + i, size - i, first, last);
+            }
+
+            BULL_TARGET_SSE2 __m128i foldCaseSse2(__m128i chunk)
+            {
+                __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), chunk));
+
+                return _mm_or_si128(chunk, _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+            }
+
+            BULL_TARGET_SSE2 int compareIgnoreCaseSse2(const char* left, const char* right, std::size_t size)
+            {
+                std::size_t i = 0;
+
+                for(; size - i >= 16; i += 16)
+                {
+                    __m128i l = foldCaseSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(left + i)));
+                    __m128i r = foldCaseSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(right + i)));
+
+                    if(_mm_movemask_epi8(_mm_cmpeq_epi8(l, r)) != 0xFFFF)
+                    {
+                        return compareIgnoreCaseScalar(left + i, right + i, 16);
+                    }
+                }
+
+                return compareIgnoreCaseScalar(left + i, right + i, size - i);
+            }
+
+            BULL_TARGET_AVX2 std::size_t countAvx2(const char* data, std::size_t size, char first, char second)
+            {
+                const __m256i firstValue  = _mm256_set1_epi8(first);
+                const __m256i secondValue = _mm256_set1_epi8(second);
+                const __m256i zero        = _mm256_setzero_si256();
+                std::size_t count = 0;
+                std::size_t i     = 0;
+
+                while(size - i >= 32)
+                {
+                    std::size_t blocks = std::min<std::size_t>((size - i) / 32, 255);
+                    __m256i accumulator = zero;
+
+                    for(std::size_t block = 0; block < blocks; block++, i += 32)
+                    {
+                        __m256i chunk   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                        __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, firstValue), _mm256_cmpeq_epi8(chunk, secondValue));
+
+                        accumulator = _mm256_sub_epi8(accumulator, matches);
+                    }
+
+                    alignas(32) Uint64 sums[4];
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_sad_epu8(accumulator, zero));
+
+                    count += sums[0] + sums[1] + sums[2] + sums[3];
+                }
+
+                /// Clear the upper halves of the registers, the SSE2 tail would otherwise pay an AVX to SSE transition on every call
+                _mm256_zeroupper();
+
+                return count + countSse2(data + i, size - i, first, second);
+            }
+
+            BULL_TARGET_AVX2 const char* findAvx2(const char* data, std::size_t size, char character)
+            {
+                const __m256i value = _mm256_set1_epi8(character);
+                std::size_t i = 0;
+
+                for(; size - i >= 32; i += 32)
+                {
+                    __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                    Uint32  mask  = _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, value));
+
+                    if(mask)
+                    {
+                        return data + i + countTrailingZeros(mask);
+                    }
+                }
+
+                _mm256_zeroupper();
+
+                return findSse2(data + i, size - i, character);
+            }
+
+            BULL_TARGET_AVX2 const char* findLastAvx2(const char* data, std::size_t size, char character)
+            {
+                const __m256i value = _mm256_set1_epi8(character);
+
+                for(; size >= 32; size -= 32)
+                {
+                    __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + size - 32));
+                    Uint32  mask  = _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, value));
+
+                    if(mask)
+                    {
+                        return data + size - 32 + findHighestBit(mask);
+                    }
+                }
+
+                _mm256_zeroupper();
+
+                return findLastSse2(data, size, character);
+            }
+
+            BULL_TARGET_AVX2 const char* searchAvx2(const char* data, std::size_t size, const char* needle, std::size_t needleSize)
+            {
+                const __m256i first = _mm256_set1_epi8(needle[0]);
+                const __m256i last  = _mm256_set1_epi8(needle[needleSize - 1]);
+                std::size_t i = 0;
+
+                for(; size - i >= needleSize - 1 + 32; i += 32)
+                {
+                    __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                    __m256i blockLast  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + needleSize - 1));
+                    Uint32  mask       = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last)));
+
+                    while(mask)
+                    {
+                        std::size_t candidate = i + countTrailingZeros(mask);
+
+                        if(std::memcmp(data + candidate + 1, needle + 1, needleSize - 2) == 0)
+                        {
+                            return data + candidate;
+                        }
+
+                        mask &= mask - 1;
+                    }
+                }
+
+                _mm256_zeroupper();
+
+                return searchSse2(data + i, size - i, needle, needleSize);
+            }
+
+            BULL_TARGET_AVX2 void flipCaseAvx2(char* data, std::size_t size, char first, char last)
+            {
+                const __m256i lowerBound = _mm256_set1_epi8(first - 1);
+                const __m256i upperBound = _mm256_set1_epi8(last + 1);
+                const __m256i caseBit    = _mm256_set1_epi8(0x20);
+                std::size_t i = 0;
+
+                for(; size - i >= 32; i += 32)
+                {
+                    __m256i chunk   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                    __m256i inRange = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, lowerBound), _mm256_cmpgt_epi8(upperBound, chunk));
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_xor_si256(chunk, _mm256_and_si256(inRange, caseBit)));
+                }
+
+                _mm256_zeroupper();
+
+                flipCaseSse2(data + i, size - i, first, last);
+            }
+
+            BULL_TARGET_AVX2 __m256i foldCaseAvx2(__m256i chunk)
+            {
+                __m256i isUpper = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), chunk));
+
+                return _mm256_or_si256(chunk, _mm256_and_si256(isUpper, _mm256_set1_epi8(0x20)));
+            }
+
+            BULL_TARGET_AVX2 int compareIgnoreCaseAvx2(const char* left, const char* right, std::size_t size)
+            {
+                std::size_t i = 0;
+
+                for(; size - i >= 32; i += 32)
+                {
+                    __m256i l = foldCaseAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(left + i)));
+                    __m256i r = foldCaseAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(right + i)));
+
+                    if(static_cast<Uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(l, r))) != 0xFFFFFFFF)
+                    {
+                        _mm256_zeroupper();
+
+                        return compareIgnoreCaseScalar(left + i, right + i, 32);
+                    }
+                }
+
+                _mm256_zeroupper();
+
+                return compareIgnoreCaseSse2(left + i, right + i, size - i);
+            }
+
+        #endif // defined BULL_SIMD_X86
+
+            KernelTable selectKernels()
+            {
+                #if defined BULL_SIMD_X86
+                    if(CpuFeatures::hasAvx2())
+                    {
+                        return KernelTable{&countAvx2, &findAvx2, &findLastAvx2, &searchAvx2, &flipCaseAvx2, &compareIgnoreCaseAvx2};
+                    }
+
+                    if(CpuFeatures::hasSse2())
+                    {
+                        return KernelTable{&countSse2, &findSse2, &findLastSse2, &searchSse2, &flipCaseSse2, &compareIgnoreCaseSse2};
+                    }
+                #endif
+
+                return KernelTable{&countScalar, &findScalar, &findLastScalar, &searchScalar, &flipCaseScalar, &compareIgnoreCaseScalar};
+            }
+
+            const KernelTable& getKernels()
+            {
+                static const KernelTable kernels = selectKernels();
+
+                return kernels;
+            }
+        }
+
+        /*! \brief Count the characters equal to one of two values
+         *
+         * \param data   The characters to scan
+         * \param size   The number of characters to scan
+         * \param first  The first value to count
+         * \param second The second value to count, can be equal to first
+         *
+         * \return Return the number of characters equal to first or second
+         *
+         */
+        std::size_t StringKernels::count(const char* data, std::size_t size, char first, char second)
+        {
+            return getKernels().count(data, size, first, second);
+        }
+
+        /*! \brief Find the first occurrence of a character
+         *
+         * \param data      The characters to scan
+         * \param size      The number of characters to scan
+         * \param character The character to find
+         *
+         * \return Return a pointer to the first occurrence, nullptr if there is none
+         *
+         */
+        const char* StringKernels::find(const char* data, std::size_t size, char character)
+        {
+            return getKernels().find(data, size, character);
+        }
+
+        /*! \brief Find the last occurrence of a character
+         *
+         * \param data      The characters to scan
+         * \param size      The number of characters to scan
+         * \param character The character to find
+         *
+         * \return Return a pointer to the last occurrence, nullptr if there is none
+         *
+         */
+        const char* StringKernels::findLast(const char* data, std::size_t size, char character)
+        {
+            return getKernels().findLast(data, size, character);
+        }
+
+        /*! \brief Find the first occurrence of a sequence of characters
+         *
+         * \param data       The characters to scan
+         * \param size       The number of characters to scan
+         * \param needle     The characters to find
+         * \param needleSize The number of characters to find
+         *
+         * \return Return a pointer to the first occurrence, nullptr if there is none
+         *
+         */
+        const char* StringKernels::search(const char* data, std::size_t size, const char* needle, std::size_t needleSize)
+        {
+            if(needleSize == 0)
+            {
+                return data;
+            }
+
+            if(needleSize > size)
+            {
+                return nullptr;
+            }
+
+            if(needleSize == 1)
+            {
+                return getKernels().find(data, size, needle[0]);
+            }
+
+            return getKernels().search(data, size, needle, needleSize);
+        }
+
+        /*! \brief Find the last occurrence of a sequence of characters
+         *
+         * \param data       The characters to scan
+         * \param size       The number of characters to scan
+         * \param needle     The characters to find
+         * \param needleSize The number of characters to find
+         *
+         * \return Return a pointer to the last occurrence, nullptr if there is none
+         *
+         */
+        const char* StringKernels::searchLast(const char* data, std::size_t size, const char* needle, std::size_t needleSize)
+        {
+            if(needleSize == 0)
+            {
+                return data + size;
+            }
+
+            if(needleSize > size)
+            {
+                return nullptr;
+            }
+
+            /// Jump between occurrences of the first character from the end, starting at the last possible position
+            std::size_t candidates = size - needleSize + 1;
+
+            while(candidates > 0)
+            {
+                const char* candidate = getKernels().findLast(data, candidates, needle[0]);
+
+                if(!candidate)
+                {
+                    return nullptr;
+                }
+
+                if(std::memcmp(candidate + 1, needle + 1, needleSize - 1) == 0)
+                {
+                    return candidate;
+                }
+
+                candidates = candidate - data;
+            }
+
+            return nullptr;
+        }
+
+        /*! \brief Set ASCII letters in uppercase
+         *
+         * \param data The characters to convert
+         * \param size The number of characters to convert
+         *
+         */
+        void StringKernels::toUppercase(char* data, std::size_t size)
+        {
+            getKernels().flipCase(data, size, 'a', 'z');
+        }
+
+        /*! \brief Set ASCII letters in lowercase
+         *
+         * \param data The characters to convert
+         * \param size The number of characters to convert
+         *
+         */
+        void StringKernels::toLowercase(char* data, std::size_t size)
+        {
+            getKernels().flipCase(data, size, 'A', 'Z');
+        }
+
+        /*! \brief Compare characters as if their ASCII letters were in lowercase
+         *
+         * \param left  The first characters to compare
+         * \param right The second characters to compare
+         * \param size  The number of characters to compare
+         *
+         * \return Return a negative value if left comes first, a positive value if right comes first, 0 if they are equal
+         *
+         */
+        int StringKernels::compareIgnoreCase(const char* left, const char* right, std::size_t size)
+        {
+            return getKernels().compareIgnoreCase(left, right, size);
+        }
+    }
+}
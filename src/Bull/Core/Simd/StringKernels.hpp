@@ -0,0 +1,100 @@
+#ifndef Bull_StringKernels_hpp
+#define Bull_StringKernels_hpp
+
+#include <cstddef>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct StringKernels
+        {
+            /*! \brief Count the characters equal to one of two values
+             *
+             * \param data   The characters to scan
+             * \param size   The number of characters to scan
+             * \param first  The first value to count
+             * \param second The second value to count, can be equal to first
+             *
+             * \return Return the number of characters equal to first or second
+             *
+             */
+            static std::size_t count(const char* data, std::size_t size, char first, char second);
+
+            /*! \brief Find the first occurrence of a character
+             *
+             * \param data      The characters to scan
+             * \param size      The number of characters to scan
+             * \param character The character to find
+             *
+             * \return Return a pointer to the first occurrence, nullptr if there is none
+             *
+             */
+            static const char* find(const char* data, std::size_t size, char character);
+
+            /*! \brief Find the last occurrence of a character
+             *
+             * \param data      The characters to scan
+             * \param size      The number of characters to scan
+             * \param character The character to find
+             *
+             * \return Return a pointer to the last occurrence, nullptr if there is none
+             *
+             */
+            static const char* findLast(const char* data, std::size_t size, char character);
+
+            /*! \brief Find the first occurrence of a sequence of characters
+             *
+             * \param data       The characters to scan
+             * \param size       The number of characters to scan
+             * \param needle     The characters to find
+             * \param needleSize The number of characters to find
+             *
+             * \return Return a pointer to the first occurrence, nullptr if there is none
+             *
+             */
+            static const char* search(const char* data, std::size_t size, const char* needle, std::size_t needleSize);
+
+            /*! \brief Find the last occurrence of a sequence of characters
+             *
+             * \param data       The characters to scan
+             * \param size       The number of characters to scan
+             * \param needle     The characters to find
+             * \param needleSize The number of characters to find
+             *
+             * \return Return a pointer to the last occurrence, nullptr if there is none
+             *
+             */
+            static const char* searchLast(const char* data, std::size_t size, const char* needle, std::size_t needleSize);
+
+            /*! \brief Set ASCII letters in uppercase
+             *
+             * \param data The characters to convert
+             * \param size The number of characters to convert
+             *
+             */
+            static void toUppercase(char* data, std::size_t size);
+
+            /*! \brief Set ASCII letters in lowercase
+             *
+             * \param data The characters to convert
+             * \param size The number of characters to convert
+             *
+             */
+            static void toLowercase(char* data, std::size_t size);
+
+            /*! \brief Compare characters as if their ASCII letters were in lowercase
+             *
+             * \param left  The first characters to compare
+             * \param right The second characters to compare
+             * \param size  The number of characters to compare
+             *
+             * \return Return a negative value if left comes first, a positive value if right comes first, 0 if they are equal
+             *
+             */
+            static int compareIgnoreCase(const char* left, const char* right, std::size_t size);
+        };
+    }
+}
+
+#endif // Bull_StringKernels_hpp
@@ -0,0 +1,602 @@
+#include <algorithm>
+#include <cstring>
+
+#include <Bull/Core/Simd/CpuFeatures.hpp>
+#include <Bull/Core/Simd/Utf8Kernels.hpp>
+
+#if defined BULL_SIMD_X86
+    #include <immintrin.h>
+#endif
+
+namespace Bull
+{
+    namespace prv
+    {
+        constexpr Uint32 Utf8Kernels::ReplacementCharacter;
+
+        namespace
+        {
+            /// As for StringKernels, the best version of each kernel is selected the first time one is used
+            struct KernelTable
+            {
+                bool (*validate)(const char* data, std::size_t size);
+                std::size_t (*countCodePoints)(const char* data, std::size_t size);
+                std::size_t (*toUtf32)(const char* data, std::size_t size, Uint32* output);
+            };
+
+            bool isAscii(const char* data)
+            {
+                Uint64 chunk;
+                std::memcpy(&chunk, data, sizeof(chunk));
+
+                return (chunk & 0x8080808080808080ull) == 0;
+            }
+
+            bool validateScalar(const char* data, std::size_t size)
+            {
+                std::size_t i = 0;
+
+                while(i < size)
+                {
+                    if(size - i >= 8 && isAscii(data + i))
+                    {
+                        i += 8;
+
+                        continue;
+                    }
+
+                    Uint32 codePoint;
+                    std::size_t length = Utf8Kernels::decode(data + i, size - i, codePoint);
+
+                    if(length == 0)
+                    {
+                        return false;
+                    }
+
+                    i += length;
+                }
+
+                return true;
+            }
+
+            std::size_t countCodePointsScalar(const char* data, std::size_t size)
+            {
+                std::size_t count = 0;
+
+                for(std::size_t i = 0; i < size; i++)
+                {
+                    if((data[i] & 0xC0) != 0x80)
+                    {
+                        count += 1;
+                    }
+                }
+
+                return count;
+            }
+
+            std::size_t toUtf32Scalar(const char* data, std::size_t size, Uint32* output)
+            {
+                std::size_t written = 0;
+                std::size_t i       = 0;
+
+                while(i < size)
+                {
+                    Uint32 codePoint;
+                    std::size_t length = Utf8Kernels::decode(data + i, size - i, codePoint);
+
+                    if(length == 0)
+                    {
+                        codePoint = Utf8Kernels::ReplacementCharacter;
+                        length    = 1;
+                    }
+
+                    output[written++] = codePoint;
+                    i += length;
+                }
+
+                return written;
+            }
+
+        #if defined BULL_SIMD_X86
+
+            BULL_TARGET_SSE2 bool validateSse2(const char* data, std::size_t size)
+            {
+                std::size_t i = 0;
+
+                while(i < size)
+                {
+                    if(size - i >= 16 && _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i))) == 0)
+                    {
+                        i += 16;
+
+                        continue;
+                    }
+
+                    Uint32 codePoint;
+                    std::size_t length = Utf8Kernels::decode(data + i, size - i, codePoint);
+
+                    if(length == 0)
+                    {
+                        return false;
+                    }
+
+                    i += length;
+                }
+
+                return true;
+            }
+
+            BULL_TARGET_SSE2 std::size_t countCodePointsSse2(const char* data, std::size_t size)
+            {
+                /// Continuation bytes are 10xxxxxx, below -64 as signed bytes
+                const __m128i threshold = _mm_set1_epi8(-64);
+                const __m128i zero      = _mm_setzero_si128();
+                std::size_t continuations = 0;
+                std::size_t i             = 0;
+
+                while(size - i >= 16)
+                {
+                    std::size_t blocks  = std::min<std::size_t>((size - i) / 16, 255);
+                    __m128i accumulator = zero;
+
+                    for(std::size_t block = 0; block < blocks; block++, i += 16)
+                    {
+                        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+
+                        accumulator = _mm_sub_epi8(accumulator, _mm_cmpgt_epi8(threshold, chunk));
+                    }
+
+                    __m128i sums = _mm_sad_epu8(accumulator, zero);
+
+                    continuations += _mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4);
+                }
+
+                return (i - continuations) + countCodePointsScalar(data + i, size - i);
+            }
+
+            BULL_TARGET_SSE2 std::size_t toUtf32Sse2(const char* data, std::size_t size, Uint32* output)
+            {
+                const __m128i zero = _mm_setzero_si128();
+                std::size_t written = 0;
+                std::size_t i       = 0;
+
+                while(i < size)
+                {
+                    /// ASCII blocks are widened directly
+                    if(size - i >= 16)
+                    {
+                        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+
+                        if(_mm_movemask_epi8(chunk) == 0)
+                        {
+                            __m128i low  = _mm_unpacklo_epi8(chunk, zero);
+                            __m128i high = _mm_unpackhi_epi8(chunk, zero);
+
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + written),      _mm_unpacklo_epi16(low, zero));
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + written + 4),  _mm_unpackhi_epi16(low, zero));
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + written + 8),  _mm_unpacklo_epi16(high, zero));
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + written + 12), _mm_unpackhi_epi16(high, zero));
+
+                            written += 16;
+                            i       += 16;
+
+                            continue;
+                        }
+                    }
+
+                    Uint32 codePoint;
+                    std::size_t length = Utf8Kernels::decode(data + i, size - i, codePoint);
+
+                    if(length == 0)
+                    {
+                        codePoint = Utf8Kernels::ReplacementCharacter;
+                        length    = 1;
+                    }
+
+                    output[written++] = codePoint;
+                    i += length;
+                }
+
+                return written;
+            }
+
+            /// The AVX2 validation is the lookup algorithm of "Validating UTF-8 In Less Than One Instruction Per Byte"
+            /// by John Keiser and Daniel Lemire: three table lookups on nibbles classify every pair of bytes,
+            /// and the third and fourth bytes of long sequences are checked with saturated subtractions
+            const Uint8 TooShort     = 1 << 0;
+            const Uint8 TooLong      = 1 << 1;
+            const Uint8 Overlong3    = 1 << 2;
+            const Uint8 TooLarge     = 1 << 3;
+            const Uint8 Surrogate    = 1 << 4;
+            const Uint8 Overlong2    = 1 << 5;
+            const Uint8 TooLarge1000 = 1 << 6;
+            const Uint8 Overlong4    = 1 << 6;
+            const Uint8 TwoConts     = 1 << 7;
+            const Uint8 Carry        = TooShort | TooLong | TwoConts;
+
+            BULL_TARGET_AVX2 __m256i lookup(__m256i indices, const Uint8* table)
+            {
+                __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+
+                return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(half), indices);
+            }
+
+            BULL_TARGET_AVX2 __m256i highNibbles(__m256i input)
+            {
+                return _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0F));
+            }
+
+            /// The input shifted by count bytes, the missing bytes come from the end of previous
+            template<int Count>
+            BULL_TARGET_AVX2 __m256i previous(__m256i input, __m256i previous)
+            {
+                return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - Count);
+            }
+
+            BULL_TARGET_AVX2 __m256i checkBlock(__m256i input, __m256i previousInput)
+            {
+                static const Uint8 byte1High[16] =
+                {
+                    TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+                    TwoConts, TwoConts, TwoConts, TwoConts,
+                    TooShort | Overlong2,
+                    TooShort,
+                    TooShort | Overlong3 | Surrogate,
+                    TooShort | TooLarge | TooLarge1000 | Overlong4
+                };
+
+                static const Uint8 byte1Low[16] =
+                {
+                    Carry | Overlong3 | Overlong2 | Overlong4,
+                    Carry | Overlong2,
+                    Carry,
+                    Carry,
+                    Carry | TooLarge,
+                    Carry | TooLarge | TooLarge1000,
+                    Carry | TooLarge | TooLarge1000,
+                    Carry | TooLarge | TooLarge1000,
+                    Carry | TooLarge | TooLarge1000,
+                    Carry | TooLarge | TooLarge1000,
+                    Carry | TooLarge | TooLarge1000,
+                    Carry | TooLarge | TooLarge1000,
+                    Carry | TooLarge | TooLarge1000,
+                    Carry | TooLarge | TooLarge1000 | Surrogate,
+                    Carry | TooLarge | TooLarge1000,
+                    Carry | TooLarge | TooLarge1000
+                };
+
+                static const Uint8 byte2High[16] =
+                {
+                    TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+                    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+                    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+                    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+                    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+                    TooShort, TooShort, TooShort, TooShort
+                };
+
+                __m256i previous1 = previous<1>(input, previousInput);
+                __m256i special   = _mm256_and_si256(_mm256_and_si256(lookup(highNibbles(previous1), byte1High),
+                                                                      lookup(_mm256_and_si256(previous1, _mm256_set1_epi8(0x0F)), byte1Low)),
+                                                     lookup(highNibbles(input), byte2High));
+
+                /// After a three or four bytes lead, the second and third following bytes must be continuations
+                __m256i thirdByte  = _mm256_subs_epu8(previous<2>(input, previousInput), _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+                __m256i fourthByte = _mm256_subs_epu8(previous<3>(input, previousInput), _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+                __m256i mustBeContinuation = _mm256_and_si256(_mm256_or_si256(thirdByte, fourthByte), _mm256_set1_epi8(static_cast<char>(0x80)));
+
+                return _mm256_xor_si256(mustBeContinuation, special);
+            }
+
+            /// Non zero where the end of the block starts a sequence which continues in the next block
+            BULL_TARGET_AVX2 __m256i checkIncomplete(__m256i input)
+            {
+                const __m256i maximum = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                         -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                         static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+
+                return _mm256_subs_epu8(input, maximum);
+            }
+
+            BULL_TARGET_AVX2 bool validateAvx2(const char* data, std::size_t size)
+            {
+                __m256i error           = _mm256_setzero_si256();
+                __m256i previousInput   = _mm256_setzero_si256();
+                __m256i previousPending = _mm256_setzero_si256();
+                std::size_t i = 0;
+
+                while(i < size)
+                {
+                    __m256i input;
+
+                    if(size - i >= 32)
+                    {
+                        input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                    }
+                    else
+                    {
+                        /// The last block is padded with ASCII zeros
+                        alignas(32) char block[32] = {};
+                        std::memcpy(block, data + i, size - i);
+
+                        input = _mm256_load_si256(reinterpret_cast<const __m256i*>(block));
+                    }
+
+                    if(_mm256_movemask_epi8(input) == 0)
+                    {
+                        error = _mm256_or_si256(error, previousPending);
+                    }
+                    else
+                    {
+                        error           = _mm256_or_si256(error, checkBlock(input, previousInput));
+                        previousPending = checkIncomplete(input);
+                    }
+
+                    previousInput = input;
+                    i += 32;
+                }
+
+                error = _mm256_or_si256(error, previousPending);
+
+                return _mm256_testz_si256(error, error) != 0;
+            }
+
+            BULL_TARGET_AVX2 std::size_t countCodePointsAvx2(const char* data, std::size_t size)
+            {
+                const __m256i threshold = _mm256_set1_epi8(-64);
+                const __m256i zero      = _mm256_setzero_si256();
+                std::size_t continuations = 0;
+                std::size_t i             = 0;
+
+                while(size - i >= 32)
+                {
+                    std::size_t blocks  = std::min<std::size_t>((size - i) / 32, 255);
+                    __m256i accumulator = zero;
+
+                    for(std::size_t block = 0; block < blocks; block++, i += 32)
+                    {
+                        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+
+                        accumulator = _mm256_sub_epi8(accumulator, _mm256_cmpgt_epi8(threshold, chunk));
+                    }
+
+                    alignas(32) Uint64 sums[4];
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_sad_epu8(accumulator, zero));
+
+                    continuations += sums[0] + sums[1] + sums[2] + sums[3];
+                }
+
+                /// Clear the upper halves of the registers, the SSE2 tail would otherwise pay an AVX to SSE transition
+                _mm256_zeroupper();
+
+                return (i - continuations) + countCodePointsSse2(data + i, size - i);
+            }
+
+        #endif // defined BULL_SIMD_X86
+
+            KernelTable selectKernels()
+            {
+                #if defined BULL_SIMD_X86
+                    if(CpuFeatures::hasAvx2())
+                    {
+                        return KernelTable{&validateAvx2, &countCodePointsAvx2, &toUtf32Sse2};
+                    }
+
+                    if(CpuFeatures::hasSse2())
+                    {
+                        return KernelTable{&validateSse2, &countCodePointsSse2, &toUtf32Sse2};
+                    }
+                #endif
+
+                return KernelTable{&validateScalar, &countCodePointsScalar, &toUtf32Scalar};
+            }
+
+            const KernelTable& getKernels()
+            {
+                static const KernelTable kernels = selectKernels();
+
+                return kernels;
+            }
+
+            bool isContinuation(char character)
+            {
+                return (character & 0xC0) == 0x80;
+            }
+        }
+
+        /*! \brief Decode the code point at the beginning of some characters
+         *
+         * \param data      The characters to decode
+         * \param size      The number of characters available
+         * \param codePoint The code point decoded
+         *
+         * \return Return the length of the sequence, 0 if it is not valid UTF-8
+         *
+         */
+        std::size_t Utf8Kernels::decode(const char* data, std::size_t size, Uint32& codePoint)
+        {
+            Uint32 lead = static_cast<Uint8>(data[0]);
+
+            if(lead < 0x80)
+            {
+                codePoint = lead;
+
+                return 1;
+            }
+
+            if(lead < 0xC2)
+            {
+                return 0;
+            }
+
+            if(lead < 0xE0)
+            {
+                if(size < 2 || !isContinuation(data[1]))
+                {
+                    return 0;
+                }
+
+                codePoint = ((lead & 0x1F) << 6) | (data[1] & 0x3F);
+
+                return 2;
+            }
+
+            if(lead < 0xF0)
+            {
+                if(size < 3 || !isContinuation(data[1]) || !isContinuation(data[2]))
+                {
+                    return 0;
+                }
+
+                codePoint = ((lead & 0x0F) << 12) | ((data[1] & 0x3F) << 6) | (data[2] & 0x3F);
+
+                return (codePoint < 0x800 || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) ? 0 : 3;
+            }
+
+            if(lead < 0xF5)
+            {
+                if(size < 4 || !isContinuation(data[1]) || !isContinuation(data[2]) || !isContinuation(data[3]))
+                {
+                    return 0;
+                }
+
+                codePoint = ((lead & 0x07) << 18) | ((data[1] & 0x3F) << 12) | ((data[2] & 0x3F) << 6) | (data[3] & 0x3F);
+
+                return (codePoint < 0x10000 || codePoint > 0x10FFFF) ? 0 : 4;
+            }
+
+            return 0;
+        }
+
+        /*! \brief Check whether some characters are valid UTF-8
+         *
+         * Overlong sequences, surrogates and code points above U+10FFFF are rejected
+         *
+         * \param data The characters to check
+         * \param size The number of characters
+         *
+         * \return Return true if the characters are valid UTF-8, false otherwise
+         *
+         */
+        bool Utf8Kernels::validate(const char* data, std::size_t size)
+        {
+            return getKernels().validate(data, size);
+        }
+
+        /*! \brief Count the code points of valid UTF-8
+         *
+         * \param data The characters to count
+         * \param size The number of characters
+         *
+         * \return Return the number of code points
+         *
+         */
+        std::size_t Utf8Kernels::countCodePoints(const char* data, std::size_t size)
+        {
+            return getKernels().countCodePoints(data, size);
+        }
+
+        /*! \brief Convert UTF-8 to UTF-32, each invalid byte becomes U+FFFD
+         *
+         * \param data   The characters to convert
+         * \param size   The number of characters
+         * \param output The buffer to write the code points in, it must hold size code points
+         *
+         * \return Return the number of code points written
+         *
+         */
+        std::size_t Utf8Kernels::toUtf32(const char* data, std::size_t size, Uint32* output)
+        {
+            return getKernels().toUtf32(data, size, output);
+        }
+
+        /*! \brief Get the number of characters needed to encode UTF-32 into UTF-8
+         *
+         * \param data The code points to encode
+         * \param size The number of code points
+         *
+         * \return Return the number of characters fromUtf32 will write
+         *
+         */
+        std::size_t Utf8Kernels::getUtf8Size(const Uint32* data, std::size_t size)
+        {
+            std::size_t length = 0;
+
+            for(std::size_t i = 0; i < size; i++)
+            {
+                Uint32 codePoint = data[i];
+
+                if(codePoint < 0x80)
+                {
+                    length += 1;
+                }
+                else if(codePoint < 0x800)
+                {
+                    length += 2;
+                }
+                else if(codePoint < 0x10000 || codePoint > 0x10FFFF)
+                {
+                    /// Surrogates and code points out of range are replaced by U+FFFD, three characters long
+                    length += 3;
+                }
+                else
+                {
+                    length += 4;
+                }
+            }
+
+            return length;
+        }
+
+        /*! \brief Convert UTF-32 to UTF-8, each invalid code point becomes U+FFFD
+         *
+         * \param data   The code points to convert
+         * \param size   The number of code points
+         * \param output The buffer to write the characters in, it must hold getUtf8Size(data, size) characters
+         *
+         * \return Return the number of characters written
+         *
+         */
+        std::size_t Utf8Kernels::fromUtf32(const Uint32* data, std::size_t size, char* output)
+        {
+            char* cursor = output;
+
+            for(std::size_t i = 0; i < size; i++)
+            {
+                Uint32 codePoint = data[i];
+
+                if(codePoint < 0x80)
+                {
+                    *cursor++ = static_cast<char>(codePoint);
+
+                    continue;
+                }
+
+                if(codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+                {
+                    codePoint = Utf8Kernels::ReplacementCharacter;
+                }
+
+                if(codePoint < 0x800)
+                {
+                    *cursor++ = static_cast<char>(0xC0 | (codePoint >> 6));
+                }
+                else if(codePoint < 0x10000)
+                {
+                    *cursor++ = static_cast<char>(0xE0 | (codePoint >> 12));
+                    *cursor++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                }
+                else
+                {
+                    *cursor++ = static_cast<char>(0xF0 | (codePoint >> 18));
+                    *cursor++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                    *cursor++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                }
+
+                *cursor++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+
+            return static_cast<std::size_t>(cursor - output);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef Bull_Utf8Kernels_hpp
+#define Bull_Utf8Kernels_hpp
+
+#include <cstddef>
+
+#include <Bull/Core/Integer.hpp>
+
+namespace Bull
+{
+    namespace prv
+    {
+        struct Utf8Kernels
+        {
+            static constexpr Uint32 ReplacementCharacter = 0xFFFD;
+
+            /*! \brief Decode the code point at the beginning of some characters
+             *
+             * \param data      The characters to decode
+             * \param size      The number of characters available
+             * \param codePoint The code point decoded
+             *
+             * \return Return the length of the sequence, 0 if it is not valid UTF-8
+             *
+             */
+            static std::size_t decode(const char* data, std::size_t size, Uint32& codePoint);
+
+            /*! \brief Check whether some characters are valid UTF-8
+             *
+             * Overlong sequences, surrogates and code points above U+10FFFF are rejected
+             *
+             * \param data The characters to check
+             * \param size The number of characters
+             *
+             * \return Return true if the characters are valid UTF-8, false otherwise
+             *
+             */
+            static bool validate(const char* data, std::size_t size);
+
+            /*! \brief Count the code points of valid UTF-8
+             *
+             * \param data The characters to count
+             * \param size The number of characters
+             *
+             * \return Return the number of code points
+             *
+             */
+            static std::size_t countCodePoints(const char* data, std::size_t size);
+
+            /*! \brief Convert UTF-8 to UTF-32, each invalid byte becomes U+FFFD
+             *
+             * \param data   The characters to convert
+             * \param size   The number of characters
+             * \param output The buffer to write the code points in, it must hold size code points
+             *
+             * \return Return the number of code points written
+             *
+             */
+            static std::size_t toUtf32(const char* data, std::size_t size, Uint32* output);
+
+            /*! \brief Get the number of characters needed to encode UTF-32 into UTF-8
+             *
+             * \param data The code points to encode
+             * \param size The number of code points
+             *
+             * \return Return the number of characters fromUtf32 will write
+             *
+             */
+            static std::size_t getUtf8Size(const Uint32* data, std::size_t size);
+
+            /*! \brief Convert UTF-32 to UTF-8, each invalid code point becomes U+FFFD
+             *
+             * \param data   The code points to convert
+             * \param size   The number of code points
+             * \param output The buffer to write the characters in, it must hold getUtf8Size(data, size) characters
+             *
+             * \return Return the number of characters written
+             *
+             */
+            static std::size_t fromUtf32(const Uint32* data, std::size_t size, char* output);
+        };
+    }
+}
+
+#endif // Bull_Utf8Kernels_hpp
@@ -1,10 +1,89 @@
-#include <cmath>
 #include <cstring>
-
+#include <functional>
+#include <new>
+#include <utility>
+
+#include <Bull/Core/Hash/WyHash.hpp>
+#include <Bull/Core/Number/FloatFormatter.hpp>
+#include <Bull/Core/Number/FloatParser.hpp>
+#include <Bull/Core/Number/IntegerFormatter.hpp>
+#include <Bull/Core/Number/IntegerParser.hpp>
+#include <Bull/Core/Simd/StringKernels.hpp>
+#include <Bull/Core/Simd/Utf8Kernels.hpp>
 #include <Bull/Core/String.hpp>
 
 namespace Bull
 {
+    namespace
+    {
+        /// Whether view looks at characters between begin and end, compared with std::less to stay defined on unrelated pointers
+        bool overlaps(const StringView& view, const char* begin, const char* end)
+        {
+            std::less<const char*> less;
+
+            return less(view.getData(), end) && less(begin, view.getData() + view.getSize());
+        }
+
+        bool isBlank(char character, char delimiter)
+        {
+            return character != delimiter && (character == ' ' || character == '\t' || character == '\r' || character == '\n');
+        }
+
+        /// Parse numbers separated by delimiter with one of the prv parsers
+        template<typename T>
+        ParseResult<std::size_t> parseList(const StringView& string, char delimiter, std::vector<T>& numbers, ParseResult<T> (*parser)(const char*, std::size_t))
+        {
+            const char* data   = string.getData();
+            std::size_t size   = string.getSize();
+            std::size_t cursor = 0;
+            std::size_t count  = 0;
+
+            while(true)
+            {
+                while(cursor < size && isBlank(data[cursor], delimiter))
+                {
+                    cursor++;
+                }
+
+                /// Nothing left, or nothing after the last delimiter
+                if(cursor == size)
+                {
+                    break;
+                }
+
+                ParseResult<T> result = parser(data + cursor, size - cursor);
+
+                if(!result.isValid())
+                {
+                    return ParseResult<std::size_t>(count, cursor + result.consumed, static_cast<typename ParseResult<std::size_t>::Error>(result.error));
+                }
+
+                numbers.push_back(result.value);
+                count  += 1;
+                cursor += result.consumed;
+
+                while(cursor < size && isBlank(data[cursor], delimiter))
+                {
+                    cursor++;
+                }
+
+                if(cursor == size)
+                {
+                    break;
+                }
+
+                if(data[cursor] != delimiter)
+                {
+                    return ParseResult<std::size_t>(count, cursor, ParseResult<std::size_t>::InvalidCharacter);
+                }
+
+                cursor++;
+            }
+
+            return ParseResult<std::size_t>(count, cursor);
+        }
+    }
+
     /*! \brief Convert a lowercase character to the uppercase equivalent character
      *
      * \param character the character to convert
@@ -75,483 +154,1401 @@ namespace Bull
         return boolean ? String("true") : String("false");
     }
 
-    /*! \brief Create a String from a number
+    /*! \brief Concatenate strings with a single allocation
      *
-     * \param number The number to represent in the string
+     * \param parts The strings to concatenate
      *
-     * \return Return a string representing the number
+     * \return Return the concatenated String
      *
      */
-    String String::number(int number)
+    String String::concat(std::initializer_list<StringView> parts)
     {
-        String string;
-        unsigned int numberCount = 1;
-        int lastInsert;
+        std::size_t size = 0;
 
-        if(number < 0)
+        for(const StringView& part : parts)
         {
-            string += '-';
-            number = std::abs(number);
+            size += part.getSize();
         }
 
-        while(number / numberCount > 10)
-        {
-            numberCount *= 10;
-        }
+        String string = String::createUninitialized(size);
+        char*  data   = string.getData();
 
-        do
+        for(const StringView& part : parts)
         {
-            if(number / numberCount < 10)
-            {
-                string += String::intToChar(number / numberCount);
-            }
-            else
-            {
-
-                string += String::intToChar(number / numberCount - lastInsert * 10);
-            }
-
-            lastInsert = static_cast<int>(number / numberCount);
-            numberCount /= 10;
-        }while(numberCount >= 1);
+            std::memcpy(data, part.getData(), part.getSize());
+            data += part.getSize();
+        }
 
         return string;
     }
 
-    /*! \brief Get the instance of SharedString which corresponding to the empty string
+    /*! \brief Create a String from a number
+     *
+     * \param number The number to represent in the String
      *
-     * \return Return the empty SharedString
+     * \return Return a String representing the number
      *
      */
-    const std::shared_ptr<String::SharedString>& String::getEmptyString()
+    String String::number(Int8 number)
     {
-        static std::shared_ptr<String::SharedString> empty = std::make_shared<String::SharedString>();
+        char buffer[String::NumberCapacity];
 
-        return empty;
+        return String(buffer, String::number(number, buffer));
     }
 
-    /*! \brief Default constructor
+    /*! \brief Create a String from a number
+     *
+     * \param number The number to represent in the String
+     *
+     * \return Return a String representing the number
      *
      */
-    String::String() :
-        m_sharedString(getEmptyString())
+    String String::number(Int16 number)
     {
-        /// Nothing
+        char buffer[String::NumberCapacity];
+
+        return String(buffer, String::number(number, buffer));
     }
 
-    /*! \brief Constructor
+    /*! \brief Create a String from a number
      *
-     * \param character The character to put in the string
+     * \param number The number to represent in the String
+     *
+     * \return Return a String representing the number
      *
      */
-    String::String(char character)
+    String String::number(Int32 number)
     {
-        if(character != String::NullByte)
-        {
-            m_sharedString = std::make_shared<SharedString>(1);
-            m_sharedString->m_string[0] = character;
-        }
-        else
-        {
-            m_sharedString = getEmptyString();
-        }
+        char buffer[String::NumberCapacity];
+
+        return String(buffer, String::number(number, buffer));
     }
 
-    /*! \brief Constructor
+    /*! \brief Create a String from a number
      *
-     * \param string The string to copy
+     * \param number The number to represent in the String
+     *
+     * \return Return a String representing the number
      *
      */
-    String::String(const char* string) :
-        String(string, (string) ? std::strlen(string) : 0)
+    String String::number(Int64 number)
     {
-        /// Nothing
+        char buffer[String::NumberCapacity];
+
+        return String(buffer, String::number(number, buffer));
     }
 
-    /*! \brief Constructor
+    /*! \brief Create a String from a number
      *
-     * \param string The string to copy
-     * \param size   The size of the string
+     * \param number The number to represent in the String
+     *
+     * \return Return a String representing the number
      *
      */
-    String::String(const char* string, std::size_t size)
+    String String::number(Uint8 number)
     {
-        if(size > 0)
-        {
-            m_sharedString = std::make_shared<SharedString>(size);
+        char buffer[String::NumberCapacity];
 
-            if(string)
-            {
-                std::memcpy(m_sharedString->m_string.get(), string, size);
-            }
-            else
-            {
-                std::memset(m_sharedString->m_string.get(), 0, size);
-            }
-        }
-        else
-        {
-            m_sharedString = getEmptyString();
-        }
+        return String(buffer, String::number(number, buffer));
     }
 
-    /*! \brief Counts the occurrences of a character in the string
+    /*! \brief Create a String from a number
      *
-     * \param character     The character to count
-     * \param start         The index to start
-     * \param caseSensitive True to be case sensitive, false otherwise
+     * \param number The number to represent in the String
      *
-     * \return Return the number of occurrences of the character in the string
+     * \return Return a String representing the number
      *
      */
-    unsigned int String::count(char character, std::size_t start, bool caseSensitive) const
+    String String::number(Uint16 number)
     {
-        if(character == String::NullByte || m_sharedString->m_size == 0)
-        {
-            return 0;
-        }
-
-        if(!caseSensitive)
-        {
-            character = String::toUpper(character);
-        }
-
-        unsigned int count = 0;
-
-        for(std::size_t i = start; i < getSize(); i++)
-        {
-            char toTest = m_sharedString->m_string[i];
-
-            if(!caseSensitive)
-            {
-                toTest = String::toUpper(toTest);
-            }
-
-            if(toTest == character)
-            {
-                count += 1;
-            }
-        }
+        char buffer[String::NumberCapacity];
 
-        return count;
+        return String(buffer, String::number(number, buffer));
     }
 
-    /*! \brief Get a subpart of the string
+    /*! \brief Create a String from a number
      *
-     * \param start The index where the substring begins
-     * \param stop  The index where the substring ends
+     * \param number The number to represent in the String
      *
-     * \return Return the substring created
+     * \return Return a String representing the number
      *
      */
-    String String::subString(std::size_t start, std::size_t stop) const
+    String String::number(Uint32 number)
     {
-        if(stop == String::npos)
-        {
-            stop = getSize();
-        }
-
-        if(start >= stop)
-        {
-            return "";
-        }
-
-        String substring;
-
-        substring.m_sharedString = std::make_shared<SharedString>(stop - (start - 1));
-        std::memcpy(substring.m_sharedString->m_string.get(), &m_sharedString->m_string[start], substring.getSize());
+        char buffer[String::NumberCapacity];
 
-        return substring;
+        return String(buffer, String::number(number, buffer));
     }
 
-    /*! \brief Check whether a String start with a specified string
+    /*! \brief Create a String from a number
      *
-     * \param string The string to test
+     * \param number The number to represent in the String
      *
-     * \return Return true if this string start with string, false otherwise
+     * \return Return a String representing the number
      *
      */
-    bool String::startWith(const String& string)
+    String String::number(Uint64 number)
     {
-        return subString(0, string.getSize() - 1) == string;
+        char buffer[String::NumberCapacity];
+
+        return String(buffer, String::number(number, buffer));
     }
 
-    /*! \brief Check whether a String end with a specified string
+    /*! \brief Create a String from a number
      *
-     * \param string The string to test
+     * \param number The number to represent in the String
      *
-     * \return Return true if this string end with string, false otherwise
+     * \return Return a String representing the number
      *
      */
-    bool String::endWith(const String& string)
+    String String::number(float number)
     {
-        return subString(getSize() - string.getSize()) == string;
+        char buffer[String::NumberCapacity];
+
+        return String(buffer, String::number(number, buffer));
     }
 
-    /*! \brief Splits a string into others
+    /*! \brief Create a String from a number
      *
-     * \param delimiter The character between two split strings
+     * \param number The number to represent in the String
      *
-     * \return Return the splits
+     * \return Return a String representing the number
      *
      */
-    std::vector<String> String::explode(char delimiter) const
+    String String::number(double number)
     {
-        std::vector<String> tokens;
-        String word;
+        char buffer[String::NumberCapacity];
 
-        for(std::size_t i = 0; i < getSize(); i++)
-        {
-            if(m_sharedString->m_string[i] == delimiter)
-            {
-                tokens.push_back(word);
+        return String(buffer, String::number(number, buffer));
+    }
 
-                word.clear();
-            }
-            else
-            {
-                word += m_sharedString->m_string[i];
-            }
-        }
+    /*! \brief Write a number in a buffer without allocating
+     *
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+     *
+     * \return Return the number of characters written, without the null character ending the buffer
+     *
+     */
+    std::size_t String::number(Int8 number, char* buffer)
+    {
+        std::size_t size = prv::IntegerFormatter::format(static_cast<Int64>(number), buffer);
 
-        if(word.getSize() > 0)
-        {
-            tokens.push_back(word);
-        }
+        buffer[size] = String::NullByte;
 
-        return tokens;
+        return size;
     }
 
-    /*! \brief Set the string in uppercase
+    /*! \brief Write a number in a buffer without allocating
      *
-     * \param start The index to start to set characters in uppercase
-     * \param stop  The index to stop to set characters in uppercase
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
      *
-     * \return Return the string after the transformation
+     * \return Return the number of characters written, without the null character ending the buffer
      *
      */
-    String& String::toUppercase(std::size_t start, std::size_t stop)
+    std::size_t String::number(Int16 number, char* buffer)
     {
-        if(stop == String::npos)
-        {
-            stop = getSize() - 1;
-        }
+        std::size_t size = prv::IntegerFormatter::format(static_cast<Int64>(number), buffer);
 
-        for(std::size_t i = start; i <= stop; i++)
-        {
-            m_sharedString->m_string[i] = String::toUpper(m_sharedString->m_string[i]);
-        }
+        buffer[size] = String::NullByte;
 
-        return (*this);
+        return size;
     }
 
-    /*! \brief Set the string in lowercase
+    /*! \brief Write a number in a buffer without allocating
      *
-     * \param start The index to start to set characters in lowercase
-     * \param stop  The index to stop to set characters in lowercase
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
      *
-     * \return Return the string after the transformation
+     * \return Return the number of characters written, without the null character ending the buffer
      *
      */
-    String& String::toLowercase(std::size_t start, std::size_t stop)
+    std::size_t String::number(Int32 number, char* buffer)
     {
-        if(stop == String::npos)
-        {
-            stop = getSize() - 1;
-        }
+        std::size_t size = prv::IntegerFormatter::format(static_cast<Int64>(number), buffer);
 
-        for(std::size_t i = start; i <= stop; i++)
-        {
-            m_sharedString->m_string[i] = String::toLower(m_sharedString->m_string[i]);
-        }
+        buffer[size] = String::NullByte;
 
-        return (*this);
+        return size;
     }
 
-    /*! \brief Inset a String at the ith index
+    /*! \brief Write a number in a buffer without allocating
      *
-     * \param toInsert The String to insert
-     * \param index    The index where the String must be inserted
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
      *
-     * \return Return this after the insert
+     * \return Return the number of characters written, without the null character ending the buffer
      *
      */
-    String& String::insert(const String& toInsert, std::size_t index)
+    std::size_t String::number(Int64 number, char* buffer)
     {
-        if(toInsert.getSize() == 0)
-        {
-            return (*this);
-        }
-
-        std::size_t start = std::min<std::size_t>(index, getSize());
-
-        if(getCapacity() >= getSize() + toInsert.getSize())
-        {
-            std::memmove(&m_sharedString->m_string[start + toInsert.getSize()], &m_sharedString->m_string[start], getSize() - start);
-            std::memcpy(&m_sharedString->m_string[start], &toInsert[0], toInsert.getSize());
+        std::size_t size = prv::IntegerFormatter::format(static_cast<Int64>(number), buffer);
 
-            m_sharedString->m_size += toInsert.getSize();
-            m_sharedString->m_string[m_sharedString->m_size] = String::NullByte;
-        }
-        else
-        {
-            std::shared_ptr<SharedString> newSharedString = std::make_shared<SharedString>(getSize() + toInsert.getSize());
+        buffer[size] = String::NullByte;
 
-            std::memcpy(&newSharedString->m_string[0], &m_sharedString->m_string[0], start);
-            std::memcpy(&newSharedString->m_string[start], &toInsert.m_sharedString->m_string[0], toInsert.getSize());
-            std::memcpy(&newSharedString->m_string[start + toInsert.getSize()], &m_sharedString->m_string[start], getSize() - start);
+        return size;
+    }
 
-            newSharedString->m_string[newSharedString->m_size] = String::NullByte;
+    /*! \brief Write a number in a buffer without allocating
+     *
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+     *
+     * \return Return the number of characters written, without the null character ending the buffer
+     *
+     */
+    std::size_t String::number(Uint8 number, char* buffer)
+    {
+        std::size_t size = prv::IntegerFormatter::format(static_cast<Uint64>(number), buffer);
 
-            m_sharedString = std::move(newSharedString);
-        }
+        buffer[size] = String::NullByte;
 
-        return (*this);
+        return size;
     }
 
-    /*! \brief Clear the string
+    /*! \brief Write a number in a buffer without allocating
+     *
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+     *
+     * \return Return the number of characters written, without the null character ending the buffer
      *
      */
-    void String::clear(bool clearMemory)
+    std::size_t String::number(Uint16 number, char* buffer)
     {
-        if(clearMemory)
-        {
-            std::memset(&m_sharedString->m_string[0], 0, getCapacity());
-            m_sharedString->m_size = m_sharedString->m_capacity;
-            m_sharedString->m_string[getSize()] = '\0';
-        }
-        else
-        {
-            m_sharedString = getEmptyString();
-        }
+        std::size_t size = prv::IntegerFormatter::format(static_cast<Uint64>(number), buffer);
+
+        buffer[size] = String::NullByte;
+
+        return size;
     }
 
-    /*! \brief Set the size of the string
+    /*! \brief Write a number in a buffer without allocating
      *
-     * \param size The new size of the string
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+     *
+     * \return Return the number of characters written, without the null character ending the buffer
      *
      */
-    void String::setSize(std::size_t size)
+    std::size_t String::number(Uint32 number, char* buffer)
     {
-        std::shared_ptr<SharedString> string = std::make_shared<SharedString>(size);
+        std::size_t size = prv::IntegerFormatter::format(static_cast<Uint64>(number), buffer);
 
-        if(size >= getSize())
-        {
-            std::memcpy(&string->m_string[0], &m_sharedString->m_string[0], getSize());
-            std::memset(&string->m_string[getSize()], 0, string->m_size - getSize());
-        }
+        buffer[size] = String::NullByte;
 
-        m_sharedString = std::move(string);
+        return size;
     }
 
-    /*! \brief Get the size of the string
+    /*! \brief Write a number in a buffer without allocating
      *
-     * \return Return the size of the string
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+     *
+     * \return Return the number of characters written, without the null character ending the buffer
      *
      */
-    std::size_t String::getSize() const
+    std::size_t String::number(Uint64 number, char* buffer)
     {
-        return m_sharedString->m_size;
+        std::size_t size = prv::IntegerFormatter::format(static_cast<Uint64>(number), buffer);
+
+        buffer[size] = String::NullByte;
+
+        return size;
     }
 
-    /*! \brief Set the capacity of the string
+    /*! \brief Write a number in a buffer without allocating
      *
-     * \param capacity Set the capacity of the string
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+     *
+     * \return Return the number of characters written, without the null character ending the buffer
      *
      */
-    void String::reserve(std::size_t capacity)
+    std::size_t String::number(float number, char* buffer)
     {
-        std::size_t size = std::min<std::size_t>(getSize(), capacity);
-        std::shared_ptr<SharedString> string = std::make_shared<SharedString>(size, capacity);
+        std::size_t size = prv::FloatFormatter::format(number, buffer);
 
-        if(size >= getSize())
-        {
-            std::memcpy(&string->m_string[0], &m_sharedString->m_string[0], getSize());
-            std::memset(&string->m_string[getSize()], 0, string->m_size - getSize());
-        }
+        buffer[size] = String::NullByte;
 
-        m_sharedString = std::move(string);
+        return size;
     }
 
-    /*! \brief Get the capacity of the string
+    /*! \brief Write a number in a buffer without allocating
      *
-     * \return Return the capacity of the string
+     * \param number The number to write
+     * \param buffer The buffer to write in, it must hold at least String::NumberCapacity characters
+     *
+     * \return Return the number of characters written, without the null character ending the buffer
      *
      */
-    std::size_t String::getCapacity() const
+    std::size_t String::number(double number, char* buffer)
     {
-        return m_sharedString->m_capacity;
+        std::size_t size = prv::FloatFormatter::format(number, buffer);
+
+        buffer[size] = String::NullByte;
+
+        return size;
     }
 
-    /*! \brief Check whether the string is empty
+    /*! \brief Parse a list of numbers separated by a delimiter
      *
-     * \return Return true if the string is empty, false otherwise
+     * Whitespace around the numbers is ignored, parsing stops at the first invalid number
+     *
+     * \param string    The text to parse
+     * \param delimiter The character between two numbers
+     * \param numbers   The vector to append the numbers to
+     *
+     * \return Return the number of values appended, with the number of characters consumed and the first error
      *
      */
-    bool String::isEmpty() const
+    ParseResult<std::size_t> String::parseNumbers(const StringView& string, char delimiter, std::vector<Int64>& numbers)
     {
-        return m_sharedString->m_size == 0;
+        return parseList(string, delimiter, numbers, &prv::IntegerParser::parseSigned);
     }
 
-    /*! \brief Casting operator override
+    /*! \brief Parse a list of numbers separated by a delimiter
      *
-     * \return Return a constant pointer to the string
+     * Whitespace around the numbers is ignored, parsing stops at the first invalid number
+     *
+     * \param string    The text to parse
+     * \param delimiter The character between two numbers
+     * \param numbers   The vector to append the numbers to
+     *
+     * \return Return the number of values appended, with the number of characters consumed and the first error
      *
      */
-    String::operator const char*() const
+    ParseResult<std::size_t> String::parseNumbers(const StringView& string, char delimiter, std::vector<Uint64>& numbers)
     {
-        return m_sharedString->m_string.get();
+        return parseList(string, delimiter, numbers, &prv::IntegerParser::parseUnsigned);
     }
 
-    /*! \brief Get the ith character of the string
+    /*! \brief Parse a list of numbers separated by a delimiter
      *
-     * \param index The index of the character to get
+     * Whitespace around the numbers is ignored, parsing stops at the first invalid number
      *
-     * \return Return the character at the ith position
+     * \param string    The text to parse
+     * \param delimiter The character between two numbers
+     * \param numbers   The vector to append the numbers to
+     *
+     * \return Return the number of values appended, with the number of characters consumed and the first error
      *
      */
-    char& String::operator[](std::size_t index)
+    ParseResult<std::size_t> String::parseNumbers(const StringView& string, char delimiter, std::vector<float>& numbers)
     {
-        return m_sharedString->m_string[index];
+        return parseList(string, delimiter, numbers, &prv::FloatParser::parseFloat);
     }
 
-    /*! \brief Get the ith character of the string
+    /*! \brief Parse a list of numbers separated by a delimiter
      *
-     * \param index The index of the character to get
+     * Whitespace around the numbers is ignored, parsing stops at the first invalid number
      *
-     * \return Return the character at the ith position
+     * \param string    The text to parse
+     * \param delimiter The character between two numbers
+     * \param numbers   The vector to append the numbers to
+     *
+     * \return Return the number of values appended, with the number of characters consumed and the first error
      *
      */
-    const char& String::operator[](std::size_t index) const
+    ParseResult<std::size_t> String::parseNumbers(const StringView& string, char delimiter, std::vector<double>& numbers)
     {
-        return m_sharedString->m_string[index];
+        return parseList(string, delimiter, numbers, &prv::FloatParser::parseDouble);
     }
 
-    /*! \brief Convert a string to an integer
+    /*! \brief Create a String from UTF-32
      *
-     * \return Return an integer representing the string
+     * \param codePoints The code points to convert
+     * \param count      The number of code points
+     *
+     * \return Return the String in UTF-8, each invalid code point gives U+FFFD
      *
      */
-    int String::toInt() const
+    String String::fromUtf32(const Uint32* codePoints, std::size_t count)
     {
-        int number = 0;
-        bool isNegatif = m_sharedString->m_string[0] == '-';
-        std::size_t i = isNegatif ? 1 : 0;
+        String string = String::createUninitialized(prv::Utf8Kernels::getUtf8Size(codePoints, count));
 
-        while(i < getSize() && m_sharedString->m_string[i] >= '0' && m_sharedString->m_string[i] <= '9')
-        {
-            number *= 10;
-            number += String::charToInt(m_sharedString->m_string[i]);
+        prv::Utf8Kernels::fromUtf32(codePoints, count, string.getData());
+
+        return string;
+    }
+
+    /*! \brief Create a String from UTF-32
+     *
+     * \param codePoints The code points to convert
+     *
+     * \return Return the String in UTF-8, each invalid code point gives U+FFFD
+     *
+     */
+    String String::fromUtf32(const std::vector<Uint32>& codePoints)
+    {
+        return fromUtf32(codePoints.data(), codePoints.size());
+    }
+
+    /*! \brief Default constructor
+     *
+     */
+    String::String() :
+        m_smallSize(0)
+    {
+        m_smallString[0] = String::NullByte;
+    }
+
+    /*! \brief Constructor
+     *
+     * \param character The character to put in the string
+     *
+     */
+    String::String(char character) :
+        m_smallSize((character != String::NullByte) ? 1 : 0)
+    {
+        m_smallString[0] = character;
+        m_smallString[1] = String::NullByte;
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string The string to copy
+     *
+     */
+    String::String(const char* string) :
+        String(string, (string) ? std::strlen(string) : 0)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string The string to copy
+     * \param size   The size of the string
+     *
+     */
+    String::String(const char* string, std::size_t size) :
+        m_smallSize(0)
+    {
+        if(size > String::SmallCapacity)
+        {
+            m_sharedString = SharedString::create(size, size);
+            m_smallSize    = LargeSize;
+        }
+        else
+        {
+            m_smallSize = static_cast<Uint8>(size);
+            m_smallString[size] = String::NullByte;
+        }
+
+        if(string)
+        {
+            std::memcpy(getData(), string, size);
+        }
+        else
+        {
+            std::memset(getData(), 0, size);
+        }
+    }
+
+    /*! \brief Constructor
+     *
+     * The characters are always stored in a block of the MemoryResource, which the String
+     * keeps using when it grows, even when they could fit in the inline buffer
+     *
+     * \param string   The string to copy
+     * \param resource The MemoryResource to allocate from, it must outlive the String
+     *
+     */
+    String::String(const StringView& string, MemoryResource& resource) :
+        String(String::createUninitialized(string.getSize(), (&resource == &MemoryResource::getDefault()) ? nullptr : &resource))
+    {
+        std::memcpy(getData(), string.getData(), string.getSize());
+    }
+
+    /*! \brief Copy constructor
+     *
+     * \param copy The String to copy
+     *
+     */
+    String::String(const String& copy) :
+        m_smallSize(copy.m_smallSize)
+    {
+        std::memcpy(m_smallString, copy.m_smallString, sizeof(m_smallString));
+
+        if(!isSmall())
+        {
+            m_sharedString->acquire();
+        }
+    }
+
+    /*! \brief Move constructor
+     *
+     * \param move The String to move, it becomes empty
+     *
+     */
+    String::String(String&& move) noexcept :
+        m_smallSize(move.m_smallSize)
+    {
+        std::memcpy(m_smallString, move.m_smallString, sizeof(m_smallString));
+
+        move.m_smallSize      = 0;
+        move.m_smallString[0] = String::NullByte;
+    }
+
+    /*! \brief Destructor
+     *
+     */
+    String::~String()
+    {
+        if(!isSmall())
+        {
+            m_sharedString->release();
+        }
+    }
+
+    /*! \brief Basic assignment operator
+     *
+     * \param copy The String to copy
+     *
+     * \return Return this after the copy
+     *
+     */
+    String& String::operator=(const String& copy)
+    {
+        if(this != &copy)
+        {
+            if(!copy.isSmall())
+            {
+                copy.m_sharedString->acquire();
+            }
+
+            if(!isSmall())
+            {
+                m_sharedString->release();
+            }
+
+            std::memcpy(m_smallString, copy.m_smallString, sizeof(m_smallString));
+            m_smallSize = copy.m_smallSize;
+        }
+
+        return (*this);
+    }
+
+    /*! \brief Move assignment operator
+     *
+     * \param move The String to move, it becomes empty
+     *
+     * \return Return this after the move
+     *
+     */
+    String& String::operator=(String&& move) noexcept
+    {
+        if(this != &move)
+        {
+            if(!isSmall())
+            {
+                m_sharedString->release();
+            }
+
+            std::memcpy(m_smallString, move.m_smallString, sizeof(m_smallString));
+            m_smallSize = move.m_smallSize;
+
+            move.m_smallSize      = 0;
+            move.m_smallString[0] = String::NullByte;
+        }
+
+        return (*this);
+    }
+
+    /*! \brief Counts the occurrences of a character in the string
+     *
+     * \param character     The character to count
+     * \param start         The index to start
+     * \param caseSensitive True to be case sensitive, false otherwise
+     *
+     * \return Return the number of occurrences of the character in the string
+     *
+     */
+    unsigned int String::count(char character, std::size_t start, bool caseSensitive) const
+    {
+        if(character == String::NullByte || start >= getSize())
+        {
+            return 0;
+        }
+
+        if(!caseSensitive)
+        {
+            return prv::StringKernels::count(getData() + start, getSize() - start, String::toUpper(character), String::toLower(character));
+        }
+
+        return prv::StringKernels::count(getData() + start, getSize() - start, character, character);
+    }
+
+    /*! \brief Get a subpart of the string
+     *
+     * \param start The index where the substring begins
+     * \param stop  The index where the substring ends
+     *
+     * \return Return the substring created
+     *
+     */
+    String String::subString(std::size_t start, std::size_t stop) const
+    {
+        if(stop == String::npos)
+        {
+            stop = getSize();
+        }
+
+        if(start >= stop || start >= getSize())
+        {
+            return "";
+        }
+
+        return String(getData() + start, std::min(stop - (start - 1), getSize() - start));
+    }
+
+    /*! \brief Get a view on a subpart of the string without copying it
+     *
+     * \param start The index where the substring begins
+     * \param stop  The index where the substring ends
+     *
+     * \return Return the view on the substring, valid until the string is modified or destroyed
+     *
+     */
+    StringView String::subView(std::size_t start, std::size_t stop) const
+    {
+        return StringView(*this).subView(start, stop);
+    }
+
+    /*! \brief Check whether a String start with a specified string
+     *
+     * \param string The string to test
+     *
+     * \return Return true if this string start with string, false otherwise
+     *
+     */
+    bool String::startWith(const StringView& string) const
+    {
+        return StringView(*this).startWith(string);
+    }
+
+    /*! \brief Check whether a String end with a specified string
+     *
+     * \param string The string to test
+     *
+     * \return Return true if this string end with string, false otherwise
+     *
+     */
+    bool String::endWith(const StringView& string) const
+    {
+        return StringView(*this).endWith(string);
+    }
+
+    /*! \brief Check whether the string start with a specified string, ignoring the case of ASCII letters
+     *
+     * \param string The string to test
+     *
+     * \return Return true if this string start with string, false otherwise
+     *
+     */
+    bool String::startWithIgnoreCase(const StringView& string) const
+    {
+        return StringView(*this).startWithIgnoreCase(string);
+    }
+
+    /*! \brief Check whether the string end with a specified string, ignoring the case of ASCII letters
+     *
+     * \param string The string to test
+     *
+     * \return Return true if this string end with string, false otherwise
+     *
+     */
+    bool String::endWithIgnoreCase(const StringView& string) const
+    {
+        return StringView(*this).endWithIgnoreCase(string);
+    }
+
+    /*! \brief Find the first occurrence of a character
+     *
+     * \param character The character to find
+     * \param start     The index to start the search
+     *
+     * \return Return the index of the occurrence, npos if there is none
+     *
+     */
+    std::size_t String::find(char character, std::size_t start) const
+    {
+        return StringView(*this).find(character, start);
+    }
+
+    /*! \brief Find the first occurrence of a string
+     *
+     * \param string The string to find
+     * \param start  The index to start the search
+     *
+     * \return Return the index where the occurrence begins, npos if there is none
+     *
+     */
+    std::size_t String::find(const StringView& string, std::size_t start) const
+    {
+        return StringView(*this).find(string, start);
+    }
+
+    /*! \brief Find the last occurrence of a character
+     *
+     * \param character The character to find
+     * \param start     The last index where the occurrence can be
+     *
+     * \return Return the index of the occurrence, npos if there is none
+     *
+     */
+    std::size_t String::rfind(char character, std::size_t start) const
+    {
+        return StringView(*this).rfind(character, start);
+    }
+
+    /*! \brief Find the last occurrence of a string
+     *
+     * \param string The string to find
+     * \param start  The last index where the occurrence can begin
+     *
+     * \return Return the index where the occurrence begins, npos if there is none
+     *
+     */
+    std::size_t String::rfind(const StringView& string, std::size_t start) const
+    {
+        return StringView(*this).rfind(string, start);
+    }
+
+    /*! \brief Check whether the string contains a character
+     *
+     * \param character The character to find
+     *
+     * \return Return true if the character is in the string, false otherwise
+     *
+     */
+    bool String::contains(char character) const
+    {
+        return StringView(*this).contains(character);
+    }
+
+    /*! \brief Check whether the string contains a string
+     *
+     * \param string The string to find
+     *
+     * \return Return true if the string is in the string, false otherwise
+     *
+     */
+    bool String::contains(const StringView& string) const
+    {
+        return StringView(*this).contains(string);
+    }
+
+    /*! \brief Replace every occurrence of a string
+     *
+     * \param pattern     The string to replace, occurrences do not overlap
+     * \param replacement The string to put instead
+     *
+     * \return Return this after the replacement
+     *
+     */
+    String& String::replaceAll(const StringView& pattern, const StringView& replacement)
+    {
+        StringView  view(*this);
+        std::size_t occurrences = 0;
+
+        if(pattern.isEmpty())
+        {
+            return (*this);
+        }
+
+        for(std::size_t position = view.find(pattern); position != String::npos; position = view.find(pattern, position + pattern.getSize()))
+        {
+            occurrences += 1;
+        }
+
+        if(occurrences == 0)
+        {
+            return (*this);
+        }
+
+        /// A uniquely owned string which does not grow is compacted in place, unless pattern or replacement look at it
+        if(replacement.getSize() <= pattern.getSize() && isUniquelyOwned() &&
+           !overlaps(pattern, getData(), getData() + getCapacity()) && !overlaps(replacement, getData(), getData() + getCapacity()))
+        {
+            char*       data   = getMutableData();
+            std::size_t write  = 0;
+            std::size_t copied = 0;
+
+            for(std::size_t position = view.find(pattern); position != String::npos; position = view.find(pattern, position + pattern.getSize()))
+            {
+                std::memmove(data + write, data + copied, position - copied);
+                write += position - copied;
+
+                std::memcpy(data + write, replacement.getData(), replacement.getSize());
+                write += replacement.getSize();
+
+                copied = position + pattern.getSize();
+            }
+
+            std::memmove(data + write, data + copied, getSize() - copied);
+            setSizeInPlace(write + getSize() - copied);
+
+            return (*this);
+        }
+
+        /// pattern and replacement may look at this, so the result is built aside
+        String result = String::createUninitialized(getSize() - occurrences * pattern.getSize() + occurrences * replacement.getSize(), getResource());
+        char*  data   = result.getData();
+        std::size_t copied = 0;
+
+        for(std::size_t position = view.find(pattern); position != String::npos; position = view.find(pattern, position + pattern.getSize()))
+        {
+            std::memcpy(data, view.getData() + copied, position - copied);
+            data += position - copied;
+
+            std::memcpy(data, replacement.getData(), replacement.getSize());
+            data += replacement.getSize();
+
+            copied = position + pattern.getSize();
+        }
+
+        std::memcpy(data, view.getData() + copied, getSize() - copied);
+
+        return (*this) = std::move(result);
+    }
+
+    /*! \brief Check whether the string is valid UTF-8
+     *
+     * \return Return true if the string is valid UTF-8, false otherwise
+     *
+     */
+    bool String::isValidUtf8() const
+    {
+        return StringView(*this).isValidUtf8();
+    }
+
+    /*! \brief Get the number of code points in the string, which must be valid UTF-8
+     *
+     * \return Return the number of code points
+     *
+     */
+    std::size_t String::getCodePointCount() const
+    {
+        return StringView(*this).getCodePointCount();
+    }
+
+    /*! \brief Iterate lazily over the code points of the string
+     *
+     * \return Return a range over the code points, valid until the string is modified or destroyed
+     *
+     */
+    StringView::CodePoints String::codePoints() const
+    {
+        return StringView(*this).codePoints();
+    }
+
+    /*! \brief Convert the string from UTF-8 to UTF-32
+     *
+     * \return Return the code points, each invalid byte gives U+FFFD
+     *
+     */
+    std::vector<Uint32> String::toUtf32() const
+    {
+        return StringView(*this).toUtf32();
+    }
+
+    /*! \brief Splits a string into others
+     *
+     * \param delimiter The character between two split strings
+     *
+     * \return Return the splits
+     *
+     */
+    std::vector<String> String::explode(char delimiter) const
+    {
+        std::vector<String> tokens;
+
+        for(const StringView& token : split(delimiter))
+        {
+            tokens.push_back(token.toString());
+        }
+
+        return tokens;
+    }
+
+    /*! \brief Splits a string into views without copying the tokens
+     *
+     * \param delimiter The character between two split strings
+     *
+     * \return Return the splits, valid until the string is modified or destroyed
+     *
+     */
+    std::vector<StringView> String::explodeView(char delimiter) const
+    {
+        std::vector<StringView> tokens;
+
+        for(const StringView& token : split(delimiter))
+        {
+            tokens.push_back(token);
+        }
+
+        return tokens;
+    }
+
+    /*! \brief Splits a string lazily
+     *
+     * \param delimiter The character between two split strings
+     *
+     * \return Return a range over the splits, valid until the string is modified or destroyed
+     *
+     */
+    StringView::Split String::split(char delimiter) const
+    {
+        return StringView(*this).split(delimiter);
+    }
+
+    /*! \brief Set the string in uppercase
+     *
+     * \param start The index to start to set characters in uppercase
+     * \param stop  The index to stop to set characters in uppercase
+     *
+     * \return Return the string after the transformation
+     *
+     */
+    String& String::toUppercase(std::size_t start, std::size_t stop)
+    {
+        if(stop == String::npos || stop >= getSize())
+        {
+            stop = getSize() - 1;
+        }
+
+        if(start < getSize() && start <= stop)
+        {
+            prv::StringKernels::toUppercase(getMutableData() + start, stop - start + 1);
+        }
+
+        return (*this);
+    }
+
+    /*! \brief Set the string in lowercase
+     *
+     * \param start The index to start to set characters in lowercase
+     * \param stop  The index to stop to set characters in lowercase
+     *
+     * \return Return the string after the transformation
+     *
+     */
+    String& String::toLowercase(std::size_t start, std::size_t stop)
+    {
+        if(stop == String::npos || stop >= getSize())
+        {
+            stop = getSize() - 1;
+        }
+
+        if(start < getSize() && start <= stop)
+        {
+            prv::StringKernels::toLowercase(getMutableData() + start, stop - start + 1);
+        }
+
+        return (*this);
+    }
+
+    /*! \brief Inset a String at the ith index
+     *
+     * \param toInsert The String to insert
+     * \param index    The index where the String must be inserted
+     *
+     * \return Return this after the insert
+     *
+     */
+    String& String::insert(const String& toInsert, std::size_t index)
+    {
+        if(toInsert.getSize() == 0)
+        {
+            return (*this);
+        }
+
+        if(&toInsert == this)
+        {
+            return insert(String(toInsert.getData(), toInsert.getSize()), index);
+        }
+
+        std::size_t start = std::min<std::size_t>(index, getSize());
+        std::size_t size  = getSize() + toInsert.getSize();
+
+        if(getCapacity() >= size && isUniquelyOwned())
+        {
+            char* data = getData();
+
+            resetHash();
+
+            std::memmove(&data[start + toInsert.getSize()], &data[start], getSize() - start);
+            std::memcpy(&data[start], toInsert.getData(), toInsert.getSize());
+
+            if(isSmall())
+            {
+                m_smallSize = static_cast<Uint8>(size);
+            }
+            else
+            {
+                m_sharedString->m_size = size;
+            }
+
+            data[size] = String::NullByte;
+        }
+        else
+        {
+            std::size_t capacity = size;
+
+            /// An owned buffer which is too small is likely to grow again, allocate ahead to keep appends linear
+            if(isUniquelyOwned() && getCapacity() < size)
+            {
+                capacity = std::max(size, getCapacity() * String::GrowthFactor);
+            }
+
+            SharedString* sharedString = SharedString::create(size, capacity, getResource());
+            char*         data         = sharedString->getString();
+
+            std::memcpy(data, getData(), start);
+            std::memcpy(data + start, toInsert.getData(), toInsert.getSize());
+            std::memcpy(data + start + toInsert.getSize(), getData() + start, getSize() - start);
+
+            setSharedString(sharedString);
+        }
+
+        return (*this);
+    }
+
+    /*! \brief Clear the string
+     *
+     */
+    void String::clear(bool clearMemory)
+    {
+        if(clearMemory)
+        {
+            std::memset(getMutableData(), 0, getCapacity());
+
+            if(isSmall())
+            {
+                m_smallSize = String::SmallCapacity;
+            }
+            else
+            {
+                m_sharedString->m_size = m_sharedString->m_capacity;
+            }
+
+            getData()[getSize()] = String::NullByte;
+        }
+        else
+        {
+            if(!isSmall())
+            {
+                m_sharedString->release();
+            }
+
+            m_smallSize      = 0;
+            m_smallString[0] = String::NullByte;
+        }
+    }
+
+    /*! \brief Set the size of the string
+     *
+     * \param size The new size of the string
+     *
+     */
+    void String::setSize(std::size_t size)
+    {
+        if(getCapacity() >= size && isUniquelyOwned())
+        {
+            std::size_t kept = std::min(size, getSize());
+
+            std::memset(getMutableData() + kept, 0, size - kept);
+            setSizeInPlace(size);
+
+            return;
+        }
+
+        String      string = String::createUninitialized(size, getResource());
+        std::size_t kept   = std::min(size, getSize());
+
+        std::memcpy(string.getData(), getData(), kept);
+        std::memset(string.getData() + kept, 0, size - kept);
+
+        (*this) = std::move(string);
+    }
+
+    /*! \brief Get the size of the string
+     *
+     * \return Return the size of the string
+     *
+     */
+    std::size_t String::getSize() const
+    {
+        return isSmall() ? m_smallSize : m_sharedString->m_size;
+    }
+
+    /*! \brief Set the capacity of the string
+     *
+     * \param capacity Set the capacity of the string
+     *
+     */
+    void String::reserve(std::size_t capacity)
+    {
+        std::size_t     size     = std::min<std::size_t>(getSize(), capacity);
+        MemoryResource* resource = getResource();
+
+        /// A string using a MemoryResource never goes back to the inline buffer, so it keeps its resource
+        if(capacity > String::SmallCapacity || resource)
+        {
+            SharedString* sharedString = SharedString::create(size, capacity, resource);
+
+            std::memcpy(sharedString->getString(), getData(), size);
+
+            setSharedString(sharedString);
+        }
+        else if(!isSmall())
+        {
+            SharedString* sharedString = m_sharedString;
+
+            std::memcpy(m_smallString, sharedString->getString(), size);
+            sharedString->release();
+
+            m_smallSize         = static_cast<Uint8>(size);
+            m_smallString[size] = String::NullByte;
+        }
+        else
+        {
+            m_smallSize         = static_cast<Uint8>(size);
+            m_smallString[size] = String::NullByte;
+        }
+    }
+
+    /*! \brief Reduce the capacity of the string to its size
+     *
+     */
+    void String::shrinkToFit()
+    {
+        if(!isSmall() && getCapacity() > getSize())
+        {
+            reserve(getSize());
+        }
+    }
+
+    /*! \brief Get the capacity of the string
+     *
+     * \return Return the capacity of the string
+     *
+     */
+    std::size_t String::getCapacity() const
+    {
+        return isSmall() ? String::SmallCapacity : m_sharedString->m_capacity;
+    }
+
+    /*! \brief Get the MemoryResource the string allocates from
+     *
+     * \return Return the MemoryResource, the default one when the string uses the global heap
+     *
+     */
+    MemoryResource& String::getMemoryResource() const
+    {
+        MemoryResource* resource = getResource();
+
+        return resource ? *resource : MemoryResource::getDefault();
+    }
+
+    /*! \brief Check whether the string is empty
+     *
+     * \return Return true if the string is empty, false otherwise
+     *
+     */
+    bool String::isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    /*! \brief Casting operator override
+     *
+     * \return Return a constant pointer to the string
+     *
+     */
+    String::operator const char*() const
+    {
+        return getData();
+    }
+
+    /*! \brief Get the ith character of the string
+     *
+     * \param index The index of the character to get
+     *
+     * \return Return the character at the ith position, the string is detached from its copies first
+     *
+     */
+    char& String::operator[](std::size_t index)
+    {
+        /// The character may be written through the reference
+        return getMutableData()[index];
+    }
+
+    /*! \brief Get the ith character of the string
+     *
+     * \param index The index of the character to get
+     *
+     * \return Return the character at the ith position
+     *
+     */
+    const char& String::operator[](std::size_t index) const
+    {
+        return getData()[index];
+    }
+
+    /*! \brief Convert a string to an integer
+     *
+     * \return Return an integer representing the string
+     *
+     */
+    int String::toInt() const
+    {
+        int number = 0;
+        const char* data = getData();
+        bool isNegatif = data[0] == '-';
+        std::size_t i = isNegatif ? 1 : 0;
+
+        while(i < getSize() && data[i] >= '0' && data[i] <= '9')
+        {
+            number *= 10;
+            number += String::charToInt(data[i]);
 
             i += 1;
         }
 
-        if(isNegatif)
+        if(isNegatif)
+        {
+            number *= -1;
+        }
+
+        return number;
+    }
+
+    /*! \brief Parse the beginning of the string as a signed 64 bits integer
+     *
+     * \return Return the value with the number of characters used, or the reason of the failure
+     *
+     */
+    ParseResult<Int64> String::toInt64() const
+    {
+        return prv::IntegerParser::parseSigned(getData(), getSize());
+    }
+
+    /*! \brief Parse the beginning of the string as an unsigned 64 bits integer
+     *
+     * \return Return the value with the number of characters used, or the reason of the failure
+     *
+     */
+    ParseResult<Uint64> String::toUint64() const
+    {
+        return prv::IntegerParser::parseUnsigned(getData(), getSize());
+    }
+
+    /*! \brief Parse the beginning of the string as a float
+     *
+     * \return Return the value with the number of characters used, or the reason of the failure
+     *
+     */
+    ParseResult<float> String::toFloat() const
+    {
+        return prv::FloatParser::parseFloat(getData(), getSize());
+    }
+
+    /*! \brief Parse the beginning of the string as a double
+     *
+     * \return Return the value with the number of characters used, or the reason of the failure
+     *
+     */
+    ParseResult<double> String::toDouble() const
+    {
+        return prv::FloatParser::parseDouble(getData(), getSize());
+    }
+
+    /*! \brief Compare the string with another one in lexicographic order
+     *
+     * \param string The string to compare with
+     *
+     * \return Return a negative value if this is before string, 0 if they are equal, a positive value otherwise
+     *
+     */
+    int String::compare(const StringView& string) const
+    {
+        int result = std::memcmp(getData(), string.getData(), std::min(getSize(), string.getSize()));
+
+        if(result != 0)
+        {
+            return result;
+        }
+
+        if(getSize() == string.getSize())
         {
-            number *= -1;
+            return 0;
         }
 
-        return number;
+        return (getSize() < string.getSize()) ? -1 : 1;
+    }
+
+    /*! \brief Get the hash of the string
+     *
+     * The hash of a long string is cached in its buffer and shared between its copies
+     *
+     * \return Return the hash of the string
+     *
+     */
+    std::size_t String::getHash() const
+    {
+        if(isSmall())
+        {
+            return static_cast<std::size_t>(prv::WyHash::compute(m_smallString, m_smallSize));
+        }
+
+        std::size_t hash = m_sharedString->m_hash.load(std::memory_order_relaxed);
+
+        if(hash == 0)
+        {
+            hash = static_cast<std::size_t>(prv::WyHash::compute(m_sharedString->getString(), m_sharedString->m_size));
+
+            m_sharedString->m_hash.store(hash, std::memory_order_relaxed);
+        }
+
+        return hash;
+    }
+
+    /*! \brief Check whether the string is equal to another string, ignoring the case of ASCII letters
+     *
+     * \param string The string to compare with
+     *
+     * \return Return true if they are equal once their ASCII letters are in lowercase, false otherwise
+     *
+     */
+    bool String::equalsIgnoreCase(const StringView& string) const
+    {
+        return StringView(*this).equalsIgnoreCase(string);
+    }
+
+    /*! \brief Compare the string with another string in lexicographic order, ignoring the case of ASCII letters
+     *
+     * \param string The string to compare with
+     *
+     * \return Return a negative value if this is before string, 0 if they are equal, a positive value otherwise
+     *
+     */
+    int String::compareIgnoreCase(const StringView& string) const
+    {
+        return StringView(*this).compareIgnoreCase(string);
+    }
+
+    /*! \brief Get the hash of the string ignoring the case of ASCII letters
+     *
+     * \return Return the same hash as getHash on the string set in lowercase, without copying it
+     *
+     */
+    std::size_t String::getHashIgnoreCase() const
+    {
+        return StringView(*this).getHashIgnoreCase();
     }
 
     /*! \brief Compare two Strings
@@ -564,7 +1561,12 @@ namespace Bull
      */
     bool operator==(const String& left, const String& right)
     {
-        return strcmp(left, right) == 0;
+        if(left.getSize() != right.getSize())
+        {
+            return false;
+        }
+
+        return left.getData() == right.getData() || std::memcmp(left.getData(), right.getData(), left.getSize()) == 0;
     }
 
     /*! \brief Compare two Strings
@@ -577,7 +1579,7 @@ namespace Bull
      */
     bool operator==(const char* left, const String& right)
     {
-        return strcmp(left, right) == 0;
+        return StringView(left) == StringView(right);
     }
 
     /*! \brief Compare two Strings
@@ -590,7 +1592,7 @@ namespace Bull
      */
     bool operator==(const String& left, const char* right)
     {
-        return strcmp(left, right) == 0;
+        return StringView(left) == StringView(right);
     }
 
     /*! \brief Compare two Strings
@@ -603,7 +1605,7 @@ namespace Bull
      */
     bool operator!=(const String& left, const String& right)
     {
-        return strcmp(left, right) != 0;
+        return !(left == right);
     }
 
     /*! \brief Compare two Strings
@@ -616,7 +1618,7 @@ namespace Bull
      */
     bool operator!=(const char* left, const String& right)
     {
-        return strcmp(left, right) != 0;
+        return !(left == right);
     }
 
     /*! \brief Compare two Strings
@@ -629,7 +1631,46 @@ namespace Bull
      */
     bool operator!=(const String& left, const char* right)
     {
-        return strcmp(left, right) != 0;
+        return !(left == right);
+    }
+
+    /*! \brief Order two Strings
+     *
+     * \param left The first String to compare
+     * \param right The second String to compare
+     *
+     * \return Return true if left is before right in lexicographic order, false otherwise
+     *
+     */
+    bool operator<(const String& left, const String& right)
+    {
+        return left.compare(right) < 0;
+    }
+
+    /*! \brief Order two Strings
+     *
+     * \param left The first String to compare
+     * \param right The second String to compare
+     *
+     * \return Return true if left is before right in lexicographic order, false otherwise
+     *
+     */
+    bool operator<(const char* left, const String& right)
+    {
+        return right.compare(left) > 0;
+    }
+
+    /*! \brief Order two Strings
+     *
+     * \param left The first String to compare
+     * \param right The second String to compare
+     *
+     * \return Return true if left is before right in lexicographic order, false otherwise
+     *
+     */
+    bool operator<(const String& left, const char* right)
+    {
+        return left.compare(right) < 0;
     }
 
     /*! \brief Concatenates two Strings
@@ -642,7 +1683,52 @@ namespace Bull
      */
     String operator+(const String& left, const String& right)
     {
-        return String(left) += right;
+        return String::concat({left, right});
+    }
+
+    /*! \brief Concatenates two Strings, reusing the storage of left
+     *
+     * \param left  The left part of the final String
+     * \param right The right part of the final String
+     *
+     * \return Return the concatenated String
+     *
+     */
+    String operator+(String&& left, const String& right)
+    {
+        left += right;
+
+        return std::move(left);
+    }
+
+    /*! \brief Concatenates two Strings, reusing the storage of right
+     *
+     * \param left  The left part of the final String
+     * \param right The right part of the final String
+     *
+     * \return Return the concatenated String
+     *
+     */
+    String operator+(const String& left, String&& right)
+    {
+        right.insert(left, 0);
+
+        return std::move(right);
+    }
+
+    /*! \brief Concatenates two Strings, reusing the storage of left
+     *
+     * \param left  The left part of the final String
+     * \param right The right part of the final String
+     *
+     * \return Return the concatenated String
+     *
+     */
+    String operator+(String&& left, String&& right)
+    {
+        left += right;
+
+        return std::move(left);
     }
 
     /*! \brief Concatenates a String at the end of the string
@@ -657,26 +1743,254 @@ namespace Bull
         return insert(right, getSize());
     }
 
-    String::SharedString::SharedString() :
-        m_size(0),
-        m_capacity(0)
+    /*! \brief Check whether the string is stored in the inline buffer
+     *
+     * \return Return true if the string does not use a shared buffer, false otherwise
+     *
+     */
+    bool String::isSmall() const
+    {
+        return m_smallSize != LargeSize;
+    }
+
+    /*! \brief Check whether the storage of the string can be modified without affecting other Strings
+     *
+     * \return Return true if the string is small or the only owner of its SharedString, false otherwise
+     *
+     */
+    bool String::isUniquelyOwned() const
     {
-        /// Nothing
+        return isSmall() || m_sharedString->isUnique();
     }
 
-    String::SharedString::SharedString(std::size_t size) :
-        m_size(size),
-        m_capacity(size),
-        m_string(new char[size + 1])
+    /*! \brief Get the characters of the string
+     *
+     * \return Return a pointer to the first character of the string
+     *
+     */
+    char* String::getData()
+    {
+        return isSmall() ? m_smallString : m_sharedString->getString();
+    }
+
+    /*! \brief Get the characters of the string
+     *
+     * \return Return a constant pointer to the first character of the string
+     *
+     */
+    const char* String::getData() const
+    {
+        return isSmall() ? m_smallString : m_sharedString->getString();
+    }
+
+    /*! \brief Create a String whose characters are not initialized
+     *
+     * \param size     The size of the String
+     * \param resource The MemoryResource to allocate from, nullptr to use the global heap
+     *
+     * \return Return the String created, with its null character already set
+     *
+     */
+    String String::createUninitialized(std::size_t size, MemoryResource* resource)
+    {
+        String string;
+
+        if(size > String::SmallCapacity || resource)
+        {
+            string.setSharedString(SharedString::create(size, size, resource));
+        }
+        else
+        {
+            string.m_smallSize         = static_cast<Uint8>(size);
+            string.m_smallString[size] = String::NullByte;
+        }
+
+        return string;
+    }
+
+    /*! \brief Get the MemoryResource the SharedString of the string comes from
+     *
+     * \return Return the MemoryResource, nullptr when the string uses the global heap or the inline buffer
+     *
+     */
+    MemoryResource* String::getResource() const
+    {
+        return isSmall() ? nullptr : m_sharedString->m_resource;
+    }
+
+    /*! \brief Make the string uniquely owned and able to hold some characters, keeping its content
+     *
+     * \param capacity The number of characters the string must be able to hold
+     *
+     * \return Return a pointer to the characters, which can be written in place
+     *
+     */
+    char* String::prepareWrite(std::size_t capacity)
+    {
+        if(getCapacity() < capacity)
+        {
+            reserve(std::max(capacity, getCapacity() * String::GrowthFactor));
+        }
+
+        return getMutableData();
+    }
+
+    /*! \brief Give the string its own copy of a shared SharedString, with the same content and capacity
+     *
+     */
+    void String::detach()
+    {
+        if(!isUniquelyOwned())
+        {
+            SharedString* sharedString = SharedString::create(getSize(), getCapacity(), getResource());
+
+            std::memcpy(sharedString->getString(), getData(), getSize());
+
+            setSharedString(sharedString);
+        }
+    }
+
+    /*! \brief Get the characters of the string to modify them in place
+     *
+     * \return Return a pointer to the characters, owned by this string only
+     *
+     */
+    char* String::getMutableData()
+    {
+        detach();
+        resetHash();
+
+        return getData();
+    }
+
+    /*! \brief Change the size of a uniquely owned string without touching its characters
+     *
+     * \param size The new size, not above the capacity
+     *
+     */
+    void String::setSizeInPlace(std::size_t size)
+    {
+        if(isSmall())
+        {
+            m_smallSize = static_cast<Uint8>(size);
+        }
+        else
+        {
+            m_sharedString->m_size = size;
+        }
+
+        getData()[size] = String::NullByte;
+    }
+
+    /*! \brief Forget the cached hash before the characters are modified in place
+     *
+     */
+    void String::resetHash()
+    {
+        if(!isSmall())
+        {
+            m_sharedString->m_hash.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /*! \brief Replace the storage of the string by a SharedString
+     *
+     * \param sharedString The SharedString to use, this takes ownership of its reference
+     *
+     */
+    void String::setSharedString(SharedString* sharedString)
+    {
+        if(!isSmall())
+        {
+            m_sharedString->release();
+        }
+
+        m_sharedString = sharedString;
+        m_smallSize    = LargeSize;
+    }
+
+    /*! \brief Allocate a SharedString and its characters in a single block
+     *
+     * \param size     The size of the string
+     * \param capacity The number of characters the block can hold
+     * \param resource The MemoryResource to allocate from, nullptr to use the global heap
+     *
+     * \return Return the SharedString created, with a single reference
+     *
+     */
+    String::SharedString* String::SharedString::create(std::size_t size, std::size_t capacity, MemoryResource* resource)
     {
-        m_string[m_size] = String::NullByte;
+        std::size_t blockSize = sizeof(SharedString) + capacity + 1;
+        void*       memory    = resource ? resource->allocate(blockSize, alignof(SharedString)) : ::operator new(blockSize);
+
+        return new(memory) SharedString(size, capacity, resource);
     }
 
-    String::SharedString::SharedString(std::size_t size, std::size_t capacity) :
+    /*! \brief Constructor
+     *
+     * \param size     The size of the string
+     * \param capacity The number of characters the block can hold
+     * \param resource The MemoryResource the block comes from, nullptr for the global heap
+     *
+     */
+    String::SharedString::SharedString(std::size_t size, std::size_t capacity, MemoryResource* resource) :
+        m_references(1),
         m_size(size),
         m_capacity(capacity),
-        m_string(new char[capacity + 1])
+        m_hash(0),
+        m_resource(resource)
+    {
+        getString()[m_size] = String::NullByte;
+    }
+
+    /*! \brief Add a reference to the SharedString
+     *
+     */
+    void String::SharedString::acquire()
+    {
+        m_references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /*! \brief Remove a reference to the SharedString and free it when it was the last one
+     *
+     */
+    void String::SharedString::release()
+    {
+        if(m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            MemoryResource* resource  = m_resource;
+            std::size_t     blockSize = sizeof(SharedString) + m_capacity + 1;
+
+            this->~SharedString();
+
+            if(resource)
+            {
+                resource->deallocate(this, blockSize, alignof(SharedString));
+            }
+            else
+            {
+                ::operator delete(this);
+            }
+        }
+    }
+
+    /*! \brief Check whether the SharedString is referenced by a single String
+     *
+     * \return Return true if there is only one reference to the SharedString, false otherwise
+     *
+     */
+    bool String::SharedString::isUnique() const
+    {
+        return m_references.load(std::memory_order_acquire) == 1;
+    }
+
+    /*! \brief Get the characters stored after the header
+     *
+     * \return Return a pointer to the first character
+     *
+     */
+    char* String::SharedString::getString()
     {
-        m_string[m_size] = String::NullByte;
+        return reinterpret_cast<char*>(this + 1);
     }
 }
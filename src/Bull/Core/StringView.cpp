@@ -0,0 +1,714 @@
+#include <algorithm>
+#include <cstring>
+
+#include <Bull/Core/Hash/WyHash.hpp>
+#include <Bull/Core/Simd/StringKernels.hpp>
+#include <Bull/Core/Simd/Utf8Kernels.hpp>
+#include <Bull/Core/String.hpp>
+#include <Bull/Core/StringView.hpp>
+
+namespace Bull
+{
+    /*! \brief Default constructor
+     *
+     */
+    StringView::StringView() :
+        m_string(""),
+        m_size(0)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string The null terminated string to look at
+     *
+     */
+    StringView::StringView(const char* string) :
+        m_string(string ? string : ""),
+        m_size(string ? std::strlen(string) : 0)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string The characters to look at
+     * \param size   The number of characters
+     *
+     */
+    StringView::StringView(const char* string, std::size_t size) :
+        m_string(string),
+        m_size(size)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string The String to look at, it must outlive the StringView
+     *
+     */
+    StringView::StringView(const String& string) :
+        m_string(string),
+        m_size(string.getSize())
+    {
+        /// Nothing
+    }
+
+    /*! \brief Get a subpart of the view, following the same rules as String::subString
+     *
+     * \param start The index where the subpart begins
+     * \param stop  The index where the subpart ends
+     *
+     * \return Return the view on the subpart
+     *
+     */
+    StringView StringView::subView(std::size_t start, std::size_t stop) const
+    {
+        if(stop == StringView::npos)
+        {
+            stop = m_size;
+        }
+
+        if(start >= stop || start >= m_size)
+        {
+            return StringView();
+        }
+
+        return StringView(m_string + start, std::min(stop - (start - 1), m_size - start));
+    }
+
+    /*! \brief Check whether the view start with a specified string
+     *
+     * \param string The string to test
+     *
+     * \return Return true if this view start with string, false otherwise
+     *
+     */
+    bool StringView::startWith(const StringView& string) const
+    {
+        if(string.m_size > m_size)
+        {
+            return false;
+        }
+
+        return std::memcmp(m_string, string.m_string, string.m_size) == 0;
+    }
+
+    /*! \brief Check whether the view end with a specified string
+     *
+     * \param string The string to test
+     *
+     * \return Return true if this view end with string, false otherwise
+     *
+     */
+    bool StringView::endWith(const StringView& string) const
+    {
+        if(string.m_size > m_size)
+        {
+            return false;
+        }
+
+        return std::memcmp(m_string + m_size - string.m_size, string.m_string, string.m_size) == 0;
+    }
+
+    /*! \brief Check whether the view start with a specified string, ignoring the case of ASCII letters
+     *
+     * \param string The string to test
+     *
+     * \return Return true if this view start with string, false otherwise
+     *
+     */
+    bool StringView::startWithIgnoreCase(const StringView& string) const
+    {
+        return string.m_size <= m_size && prv::StringKernels::compareIgnoreCase(m_string, string.m_string, string.m_size) == 0;
+    }
+
+    /*! \brief Check whether the view end with a specified string, ignoring the case of ASCII letters
+     *
+     * \param string The string to test
+     *
+     * \return Return true if this view end with string, false otherwise
+     *
+     */
+    bool StringView::endWithIgnoreCase(const StringView& string) const
+    {
+        return string.m_size <= m_size && prv::StringKernels::compareIgnoreCase(m_string + m_size - string.m_size, string.m_string, string.m_size) == 0;
+    }
+
+    /*! \brief Check whether the view is equal to another string, ignoring the case of ASCII letters
+     *
+     * \param string The string to compare with
+     *
+     * \return Return true if they are equal once their ASCII letters are in lowercase, false otherwise
+     *
+     */
+    bool StringView::equalsIgnoreCase(const StringView& string) const
+    {
+        return m_size == string.m_size && prv::StringKernels::compareIgnoreCase(m_string, string.m_string, m_size) == 0;
+    }
+
+    /*! \brief Compare the view with another string in lexicographic order, ignoring the case of ASCII letters
+     *
+     * \param string The string to compare with
+     *
+     * \return Return a negative value if this is before string, 0 if they are equal, a positive value otherwise
+     *
+     */
+    int StringView::compareIgnoreCase(const StringView& string) const
+    {
+        int result = prv::StringKernels::compareIgnoreCase(m_string, string.m_string, std::min(m_size, string.m_size));
+
+        if(result != 0 || m_size == string.m_size)
+        {
+            return result;
+        }
+
+        return (m_size < string.m_size) ? -1 : 1;
+    }
+
+    /*! \brief Get the hash of the view ignoring the case of ASCII letters
+     *
+     * \return Return the same hash as getHash on the view set in lowercase, without copying it
+     *
+     */
+    std::size_t StringView::getHashIgnoreCase() const
+    {
+        return static_cast<std::size_t>(prv::WyHash::computeLowercase(m_string, m_size));
+    }
+
+    /*! \brief Find the first occurrence of a character
+     *
+     * \param character The character to find
+     * \param start     The index to start the search
+     *
+     * \return Return the index of the occurrence, npos if there is none
+     *
+     */
+    std::size_t StringView::find(char character, std::size_t start) const
+    {
+        if(start >= m_size)
+        {
+            return StringView::npos;
+        }
+
+        const char* occurrence = prv::StringKernels::find(m_string + start, m_size - start, character);
+
+        return occurrence ? occurrence - m_string : StringView::npos;
+    }
+
+    /*! \brief Find the first occurrence of a string
+     *
+     * \param string The string to find
+     * \param start  The index to start the search
+     *
+     * \return Return the index where the occurrence begins, npos if there is none
+     *
+     */
+    std::size_t StringView::find(const StringView& string, std::size_t start) const
+    {
+        if(start > m_size)
+        {
+            return StringView::npos;
+        }
+
+        const char* occurrence = prv::StringKernels::search(m_string + start, m_size - start, string.m_string, string.m_size);
+
+        return occurrence ? occurrence - m_string : StringView::npos;
+    }
+
+    /*! \brief Find the last occurrence of a character
+     *
+     * \param character The character to find
+     * \param start     The last index where the occurrence can be
+     *
+     * \return Return the index of the occurrence, npos if there is none
+     *
+     */
+    std::size_t StringView::rfind(char character, std::size_t start) const
+    {
+        std::size_t size = (start >= m_size) ? m_size : start + 1;
+        const char* occurrence = prv::StringKernels::findLast(m_string, size, character);
+
+        return occurrence ? occurrence - m_string : StringView::npos;
+    }
+
+    /*! \brief Find the last occurrence of a string
+     *
+     * \param string The string to find
+     * \param start  The last index where the occurrence can begin
+     *
+     * \return Return the index where the occurrence begins, npos if there is none
+     *
+     */
+    std::size_t StringView::rfind(const StringView& string, std::size_t start) const
+    {
+        if(string.m_size > m_size)
+        {
+            return StringView::npos;
+        }
+
+        /// Only the characters an occurrence beginning before start can cover are searched
+        std::size_t size = (start >= m_size - string.m_size) ? m_size : start + string.m_size;
+        const char* occurrence = prv::StringKernels::searchLast(m_string, size, string.m_string, string.m_size);
+
+        return occurrence ? occurrence - m_string : StringView::npos;
+    }
+
+    /*! \brief Check whether the view contains a character
+     *
+     * \param character The character to find
+     *
+     * \return Return true if the character is in the view, false otherwise
+     *
+     */
+    bool StringView::contains(char character) const
+    {
+        return find(character) != StringView::npos;
+    }
+
+    /*! \brief Check whether the view contains a string
+     *
+     * \param string The string to find
+     *
+     * \return Return true if the string is in the view, false otherwise
+     *
+     */
+    bool StringView::contains(const StringView& string) const
+    {
+        return find(string) != StringView::npos;
+    }
+
+    /*! \brief Split the view lazily
+     *
+     * \param delimiter The character between two tokens
+     *
+     * \return Return a range over the tokens, with the same tokens as String::explode
+     *
+     */
+    StringView::Split StringView::split(char delimiter) const
+    {
+        return Split(*this, delimiter);
+    }
+
+    /*! \brief Check whether the view is valid UTF-8
+     *
+     * \return Return true if the view is valid UTF-8, false otherwise
+     *
+     */
+    bool StringView::isValidUtf8() const
+    {
+        return prv::Utf8Kernels::validate(m_string, m_size);
+    }
+
+    /*! \brief Get the number of code points in the view, which must be valid UTF-8
+     *
+     * \return Return the number of code points
+     *
+     */
+    std::size_t StringView::getCodePointCount() const
+    {
+        return prv::Utf8Kernels::countCodePoints(m_string, m_size);
+    }
+
+    /*! \brief Iterate lazily over the code points of the view
+     *
+     * \return Return a range over the code points, each invalid byte gives U+FFFD
+     *
+     */
+    StringView::CodePoints StringView::codePoints() const
+    {
+        return CodePoints(*this);
+    }
+
+    /*! \brief Convert the view from UTF-8 to UTF-32
+     *
+     * \return Return the code points, each invalid byte gives U+FFFD
+     *
+     */
+    std::vector<Uint32> StringView::toUtf32() const
+    {
+        /// A code point takes at least one character, the vector is shrunk once the conversion is done
+        std::vector<Uint32> codePoints(m_size);
+
+        codePoints.resize(prv::Utf8Kernels::toUtf32(m_string, m_size, codePoints.data()));
+
+        return codePoints;
+    }
+
+    /*! \brief Copy the viewed characters into a String
+     *
+     * \return Return the String created
+     *
+     */
+    String StringView::toString() const
+    {
+        return String(m_string, m_size);
+    }
+
+    /*! \brief Get the viewed characters
+     *
+     * \return Return a pointer to the first character, not necessarily null terminated
+     *
+     */
+    const char* StringView::getData() const
+    {
+        return m_string;
+    }
+
+    /*! \brief Get the size of the view
+     *
+     * \return Return the number of characters in the view
+     *
+     */
+    std::size_t StringView::getSize() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Check whether the view is empty
+     *
+     * \return Return true if the view is empty, false otherwise
+     *
+     */
+    bool StringView::isEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /*! \brief Get the ith character of the view
+     *
+     * \param index The index of the character to get
+     *
+     * \return Return the character at the ith position
+     *
+     */
+    const char& StringView::operator[](std::size_t index) const
+    {
+        return m_string[index];
+    }
+
+    /*! \brief Compare two StringViews
+     *
+     * \param left  The first StringView to compare
+     * \param right The second StringView to compare
+     *
+     * \return Return true if left and right are equal, false otherwise
+     *
+     */
+    bool operator==(const StringView& left, const StringView& right)
+    {
+        return left.m_size == right.m_size && std::memcmp(left.m_string, right.m_string, left.m_size) == 0;
+    }
+
+    /*! \brief Compare two StringViews
+     *
+     * \param left  The first StringView to compare
+     * \param right The second StringView to compare
+     *
+     * \return Return true if left and right are not equal, false otherwise
+     *
+     */
+    bool operator!=(const StringView& left, const StringView& right)
+    {
+        return !(left == right);
+    }
+
+    /*! \brief Constructor
+     *
+     * \param split    The Split to iterate over
+     * \param position The index of the beginning of the current token
+     *
+     */
+    StringView::Split::Iterator::Iterator(const Split& split, std::size_t position) :
+        m_split(&split),
+        m_position(position),
+        m_next(StringView::npos)
+    {
+        if(m_position != StringView::npos)
+        {
+            m_next = m_split->findToken(m_position, m_token);
+
+            if(m_next == StringView::npos)
+            {
+                m_position = StringView::npos;
+            }
+        }
+    }
+
+    /*! \brief Get the current token
+     *
+     * \return Return the current token
+     *
+     */
+    const StringView& StringView::Split::Iterator::operator*() const
+    {
+        return m_token;
+    }
+
+    /*! \brief Get the current token
+     *
+     * \return Return a pointer to the current token
+     *
+     */
+    const StringView* StringView::Split::Iterator::operator->() const
+    {
+        return &m_token;
+    }
+
+    /*! \brief Move to the next token
+     *
+     * \return Return this after the move
+     *
+     */
+    StringView::Split::Iterator& StringView::Split::Iterator::operator++()
+    {
+        m_position = m_next;
+
+        if(m_position != StringView::npos)
+        {
+            m_next = m_split->findToken(m_position, m_token);
+
+            if(m_next == StringView::npos)
+            {
+                m_position = StringView::npos;
+            }
+        }
+
+        return (*this);
+    }
+
+    /*! \brief Compare two Iterators
+     *
+     * \param right The Iterator to compare with this
+     *
+     * \return Return true if this and right are on the same token, false otherwise
+     *
+     */
+    bool StringView::Split::Iterator::operator==(const Iterator& right) const
+    {
+        return m_split == right.m_split && m_position == right.m_position;
+    }
+
+    /*! \brief Compare two Iterators
+     *
+     * \param right The Iterator to compare with this
+     *
+     * \return Return true if this and right are not on the same token, false otherwise
+     *
+     */
+    bool StringView::Split::Iterator::operator!=(const Iterator& right) const
+    {
+        return !((*this) == right);
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string    The characters to split
+     * \param delimiter The character between two tokens
+     *
+     */
+    StringView::Split::Split(const StringView& string, char delimiter) :
+        m_string(string),
+        m_delimiter(delimiter),
+        m_position(0)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Get the next token
+     *
+     * \param token The StringView to fill with the token
+     *
+     * \return Return true if a token was found, false at the end of the string
+     *
+     */
+    bool StringView::Split::next(StringView& token)
+    {
+        if(m_position == StringView::npos)
+        {
+            return false;
+        }
+
+        m_position = findToken(m_position, token);
+
+        return m_position != StringView::npos;
+    }
+
+    /*! \brief Get an Iterator on the first token
+     *
+     * \return Return the Iterator
+     *
+     */
+    StringView::Split::Iterator StringView::Split::begin() const
+    {
+        return Iterator(*this, m_position);
+    }
+
+    /*! \brief Get an Iterator past the last token
+     *
+     * \return Return the Iterator
+     *
+     */
+    StringView::Split::Iterator StringView::Split::end() const
+    {
+        return Iterator(*this, StringView::npos);
+    }
+
+    /*! \brief Find the token beginning at a position
+     *
+     * \param position The index where the token begins
+     * \param token    The StringView to fill with the token
+     *
+     * \return Return the index where the next token begins, StringView::npos if there is no token at position
+     *
+     */
+    std::size_t StringView::Split::findToken(std::size_t position, StringView& token) const
+    {
+        if(position >= m_string.m_size)
+        {
+            return StringView::npos;
+        }
+
+        const char* begin     = m_string.m_string + position;
+        const char* delimiter = prv::StringKernels::find(begin, m_string.m_size - position, m_delimiter);
+
+        if(delimiter)
+        {
+            token = StringView(begin, delimiter - begin);
+
+            return position + token.m_size + 1;
+        }
+
+        token = StringView(begin, m_string.m_size - position);
+
+        return m_string.m_size;
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string   The characters to decode
+     * \param position The index of the beginning of the current code point
+     *
+     */
+    StringView::CodePoints::Iterator::Iterator(const StringView& string, std::size_t position) :
+        m_string(string),
+        m_position(position),
+        m_length(0),
+        m_codePoint(0)
+    {
+        decode();
+    }
+
+    /*! \brief Get the current code point
+     *
+     * \return Return the current code point, U+FFFD if it is not valid UTF-8
+     *
+     */
+    Uint32 StringView::CodePoints::Iterator::operator*() const
+    {
+        return m_codePoint;
+    }
+
+    /*! \brief Move to the next code point
+     *
+     * \return Return this after the move
+     *
+     */
+    StringView::CodePoints::Iterator& StringView::CodePoints::Iterator::operator++()
+    {
+        m_position += m_length;
+
+        decode();
+
+        return (*this);
+    }
+
+    /*! \brief Get the index of the current code point
+     *
+     * \return Return the index of the first character of the current code point
+     *
+     */
+    std::size_t StringView::CodePoints::Iterator::getPosition() const
+    {
+        return m_position;
+    }
+
+    /*! \brief Compare two Iterators
+     *
+     * \param right The Iterator to compare with this
+     *
+     * \return Return true if this and right are on the same code point, false otherwise
+     *
+     */
+    bool StringView::CodePoints::Iterator::operator==(const Iterator& right) const
+    {
+        return m_string.m_string == right.m_string.m_string && m_position == right.m_position;
+    }
+
+    /*! \brief Compare two Iterators
+     *
+     * \param right The Iterator to compare with this
+     *
+     * \return Return true if this and right are not on the same code point, false otherwise
+     *
+     */
+    bool StringView::CodePoints::Iterator::operator!=(const Iterator& right) const
+    {
+        return !((*this) == right);
+    }
+
+    /*! \brief Decode the code point at the current position
+     *
+     */
+    void StringView::CodePoints::Iterator::decode()
+    {
+        if(m_position >= m_string.m_size)
+        {
+            m_position = m_string.m_size;
+            m_length   = 0;
+
+            return;
+        }
+
+        m_length = prv::Utf8Kernels::decode(m_string.m_string + m_position, m_string.m_size - m_position, m_codePoint);
+
+        if(m_length == 0)
+        {
+            m_codePoint = prv::Utf8Kernels::ReplacementCharacter;
+            m_length    = 1;
+        }
+    }
+
+    /*! \brief Constructor
+     *
+     * \param string The characters to decode
+     *
+     */
+    StringView::CodePoints::CodePoints(const StringView& string) :
+        m_string(string)
+    {
+        /// Nothing
+    }
+
+    /*! \brief Get an Iterator on the first code point
+     *
+     * \return Return the Iterator
+     *
+     */
+    StringView::CodePoints::Iterator StringView::CodePoints::begin() const
+    {
+        return Iterator(m_string, 0);
+    }
+
+    /*! \brief Get an Iterator past the last code point
+     *
+     * \return Return the Iterator
+     *
+     */
+    StringView::CodePoints::Iterator StringView::CodePoints::end() const
+    {
+        return Iterator(m_string, m_string.m_size);
+    }
+}
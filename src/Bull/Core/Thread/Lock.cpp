@@ -12,10 +12,7 @@ namespace Bull
     Lock::Lock(Mutex& mutex) :
         m_mutex(mutex)
     {
-        if(!m_mutex.isLocked())
-        {
-            m_mutex.lock();
-        }
+        m_mutex.lock();
     }
 
     /*! Destructor
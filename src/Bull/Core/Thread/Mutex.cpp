@@ -68,9 +68,9 @@ namespace Bull
     {
         if(m_impl)
         {
-            m_impl->unlock();
-
             m_locked = false;
+
+            m_impl->unlock();
         }
     }
 
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstring>
 
 #include <Bull/Window/VideoMode.hpp>
 #include <Bull/Window/VideoModeImpl.hpp>
@@ -86,4 +87,34 @@ namespace Bull
 
         return std::find(all.begin(), all.end(), (*this)) != all.end();
     }
+
+    /*! \brief Constructor
+     *
+     * \param value The VideoMode to write, as widthxheightxbitsPerPixel
+     *
+     */
+    Formatter<VideoMode>::Formatter(const VideoMode& value)
+    {
+        m_size = formatTo(m_buffer, sizeof(m_buffer), "{}x{}x{}", value.width, value.height, value.bitsPerPixel);
+    }
+
+    /*! \brief Get the number of characters to write
+     *
+     * \return Return the number of characters
+     *
+     */
+    std::size_t Formatter<VideoMode>::getSize() const
+    {
+        return m_size;
+    }
+
+    /*! \brief Write the VideoMode
+     *
+     * \param output The buffer to write in, it must hold getSize() characters
+     *
+     */
+    void Formatter<VideoMode>::write(char* output) const
+    {
+        std::memcpy(output, m_buffer, m_size);
+    }
 }